@@ -50,11 +50,19 @@
 
 #include <Adafruit_GFX.h>
 #include "Adafruit_SSD1306.h"
-#include "splash.h"
+#if !defined(SSD1306_NO_SPLASH)
+ #include "splash.h"
+#endif
 
 // SOME DEFINES AND STATIC VARIABLES USED INTERNALLY -----------------------
 
-#if defined(BUFFER_LENGTH)
+#if defined(SSD1306_WIRE_MAX)
+ #define WIRE_MAX SSD1306_WIRE_MAX       ///< User-specified buffer size
+#elif defined(I2C_BUFFER_LENGTH)
+ #define WIRE_MAX I2C_BUFFER_LENGTH      ///< ESP32 Wire lib (128 bytes)
+#elif defined(WIRE_BUFFER_SIZE)
+ #define WIRE_MAX WIRE_BUFFER_SIZE       ///< RP2040 (arduino-pico) Wire lib
+#elif defined(BUFFER_LENGTH)
  #define WIRE_MAX BUFFER_LENGTH          ///< AVR or similar Wire lib
 #elif defined(SERIAL_BUFFER_SIZE)
  #define WIRE_MAX (SERIAL_BUFFER_SIZE-1) ///< Newer Wire uses RingBuffer
@@ -62,15 +70,83 @@
  #define WIRE_MAX 32                     ///< Use common Arduino core default
 #endif
 
+#if defined(__AVR__)
+ #define SPI_BOUNCE 16 ///< Bounce buffer for block SPI writes, bytes
+#else
+ #define SPI_BOUNCE 64 ///< Bounce buffer for block SPI writes, bytes
+#endif
+
 #define ssd1306_swap(a, b) \
   (((a) ^= (b)), ((b) ^= (a)), ((a) ^= (b))) ///< No-temp-var swap operation
 
+// Native word size used when comparing the buffer against the shadow copy
+// of display RAM. may_alias permits reading the byte buffer through it.
+#if defined(__AVR__)
+ typedef uint8_t ssd1306_word;  ///< 8-bit MCU, nothing to gain from wider
+#elif defined(__SIZEOF_POINTER__) && (__SIZEOF_POINTER__ >= 8)
+ typedef uint64_t __attribute__((__may_alias__)) ssd1306_word; ///< 64-bit
+#else
+ typedef uint32_t __attribute__((__may_alias__)) ssd1306_word; ///< 32-bit
+#endif
+
+#if defined(SSD1306_ENABLE_STATS)
+ #define STAT_ADD(field, n) stats.field += (n)      ///< Bump traffic counter
+ #define STAT_TIMER uint32_t statStart = micros()   ///< Start timing a call
+ #define STAT_TIME(field) stats.field += micros() - statStart ///< End timing
+#else // Instrumentation disabled, these all compile to nothing
+ #define STAT_ADD(field, n) ///< Dummy stand-in define
+ #define STAT_TIMER         ///< keeps compiler happy
+ #define STAT_TIME(field)   ///< keeps compiler happy
+#endif
+
+#if defined(SSD1306_ENABLE_TRACE)
+ #define TRACE(event, count) \
+  if(traceHook) (*traceHook)(this, event, count) ///< Call user's trace hook
+#else
+ #define TRACE(event, count) ///< Dummy stand-in define
+#endif
+
 #if ARDUINO >= 100
  #define WIRE_WRITE wire->write ///< Wire write function in recent Arduino lib
 #else
  #define WIRE_WRITE wire->send  ///< Wire write function in older Arduino lib
 #endif
 
+// Which transport an instance uses. Any compiled out (see SSD1306_NO_I2C
+// etc. in the header) make these constant, so the compiler drops the code
+// for the unused transports and the checks themselves. USE_HWSPI is only
+// tested once I2C has been ruled out.
+#if defined(SSD1306_NO_I2C) && defined(SSD1306_NO_HWSPI) && \
+    defined(SSD1306_NO_SOFTSPI)
+ #error "SSD1306_NO_I2C, _NO_HWSPI and _NO_SOFTSPI leave no transport"
+#elif defined(SSD1306_NO_HWSPI) && defined(SSD1306_NO_SOFTSPI)
+ #define USE_WIRE  true           ///< I2C is the only transport
+#elif defined(SSD1306_NO_I2C)
+ #define USE_WIRE  false          ///< I2C compiled out
+#else
+ #define USE_WIRE  (wire != NULL) ///< I2C if constructed with TwoWire
+#endif
+#if defined(SSD1306_NO_SOFTSPI)
+ #define USE_HWSPI true           ///< Hardware is the only SPI
+#elif defined(SSD1306_NO_HWSPI)
+ #define USE_HWSPI false          ///< Hardware SPI compiled out
+#else
+ #define USE_HWSPI (spi != NULL)  ///< Hardware SPI if given SPIClass
+#endif
+
+// Start an I2C transmission to the display, with the given control byte
+// (0x00 for commands, 0x40 for data), or end it, noting it in the stats.
+// Any commands still queued by wireCommand() go out first.
+#define WIRE_BEGIN(ctrl)             \
+ if(cmdOut) wireFlush();             \
+ wire->beginTransmission(i2caddr);   \
+ WIRE_WRITE((uint8_t)(ctrl));        \
+ STAT_ADD(i2cTransmissions, 1);      \
+ STAT_ADD(bytes, 1) ///< Start I2C transmission
+#define WIRE_END(count)              \
+ wire->endTransmission();            \
+ TRACE(SSD1306_TRACE_CHUNK, count) ///< End I2C transmission
+
 #ifdef HAVE_PORTREG
  #define SSD1306_SELECT       *csPort &= ~csPinMask; ///< Device select
  #define SSD1306_DESELECT     *csPort |=  csPinMask; ///< Device deselect
@@ -84,8 +160,12 @@
 #endif
 
 #if (ARDUINO >= 157) && !defined(ARDUINO_STM32_FEATHER)
- #define SETWIRECLOCK wire->setClock(wireClk)    ///< Set before I2C transfer
- #define RESWIRECLOCK wire->setClock(restoreClk) ///< Restore after I2C xfer
+ #define SETWIRECLOCK \
+  wire->setClock(wireClk);    STAT_ADD(clockChanges, 1) ///< Set before xfer
+ #define RESWIRECLOCK \
+  if(restoreClk != wireClk) { \
+    wire->setClock(restoreClk); STAT_ADD(clockChanges, 1); \
+  } ///< Restore after, unless same
 #else // setClock() is not present in older Arduino Wire lib (or WICED)
  #define SETWIRECLOCK ///< Dummy stand-in define
  #define RESWIRECLOCK ///< keeps compiler happy
@@ -106,30 +186,42 @@
 // beginning and end of I2C transfers (the Wire clock may be sped up before
 // issuing data to the display, then restored to the default rate afterward
 // so other I2C device types still work).  All of these are encapsulated
-// in the TRANSACTION_* macros.
+// in the TRANSACTION_* macros. Transactions nest, and only the outermost
+// one does the setup, so a bus session (see beginBusSession()) can span
+// many library calls. I2C commands queued within a transaction are sent
+// at its end, so other devices may use the bus between library calls.
 
 // Check first if Wire, then hardware SPI, then soft SPI:
-#define TRANSACTION_START   \
- if(wire) {                 \
-   SETWIRECLOCK;            \
- } else {                   \
-   if(spi) {                \
-     SPI_TRANSACTION_START; \
-   }                        \
-   SSD1306_SELECT;          \
+#define TRANSACTION_START     \
+ if(!busSession++) {          \
+   if(USE_WIRE) {             \
+     SETWIRECLOCK;            \
+   } else {                   \
+     if(USE_HWSPI) {          \
+       SPI_TRANSACTION_START; \
+     }                        \
+     SSD1306_SELECT;          \
+     STAT_ADD(spiTransactions, 1); \
+   }                          \
  } ///< Wire, SPI or bitbang transfer setup
-#define TRANSACTION_END     \
- if(wire) {                 \
-   RESWIRECLOCK;            \
- } else {                   \
-   SSD1306_DESELECT;        \
-   if(spi) {                \
-     SPI_TRANSACTION_END;   \
-   }                        \
+#define TRANSACTION_END       \
+ if(USE_WIRE && cmdOut) {     \
+   wireFlush();               \
+ }                            \
+ if(!--busSession) {          \
+   if(USE_WIRE) {             \
+     RESWIRECLOCK;            \
+   } else {                   \
+     SSD1306_DESELECT;        \
+     if(USE_HWSPI) {          \
+       SPI_TRANSACTION_END;   \
+     }                        \
+   }                          \
  } ///< Wire, SPI or bitbang transfer end
 
 // CONSTRUCTORS, DESTRUCTOR ------------------------------------------------
 
+#if !defined(SSD1306_NO_I2C)
 /*!
     @brief  Constructor for I2C-interfaced SSD1306 displays.
     @param  w
@@ -166,13 +258,19 @@
 Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi,
   int8_t rst_pin, uint32_t clkDuring, uint32_t clkAfter) :
   Adafruit_GFX(w, h), spi(NULL), wire(twi ? twi : &Wire), buffer(NULL),
+  dirtyLo(NULL), dirtyHi(NULL), shadow(NULL), pageSum(NULL),
+  front(NULL), transport(NULL), doneCallback(NULL), wireChunk(WIRE_MAX),
+  cmdOut(0), busSession(0), bandPages(0), framePeriod(0), coalescedCalls(0),
+  fps(0), framePending(false),
   mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1), rstPin(rst_pin)
 #if ARDUINO >= 157
   , wireClk(clkDuring), restoreClk(clkAfter)
 #endif
 {
 }
+#endif
 
+#if !defined(SSD1306_NO_SOFTSPI)
 /*!
     @brief  Constructor for SPI SSD1306 displays, using software (bitbang)
             SPI.
@@ -203,10 +301,16 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi,
 Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h,
   int8_t mosi_pin, int8_t sclk_pin, int8_t dc_pin, int8_t rst_pin,
   int8_t cs_pin) : Adafruit_GFX(w, h), spi(NULL), wire(NULL), buffer(NULL),
+  dirtyLo(NULL), dirtyHi(NULL), shadow(NULL), pageSum(NULL),
+  front(NULL), transport(NULL), doneCallback(NULL), wireChunk(WIRE_MAX),
+  cmdOut(0), busSession(0), bandPages(0), framePeriod(0), coalescedCalls(0),
+  fps(0), framePending(false),
   mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin), csPin(cs_pin),
   rstPin(rst_pin) {
 }
+#endif
 
+#if !defined(SSD1306_NO_HWSPI)
 /*!
     @brief  Constructor for SPI SSD1306 displays, using native hardware SPI.
     @param  w
@@ -236,12 +340,18 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h,
 Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass *spi,
   int8_t dc_pin, int8_t rst_pin, int8_t cs_pin, uint32_t bitrate) :
   Adafruit_GFX(w, h), spi(spi ? spi : &SPI), wire(NULL), buffer(NULL),
+  dirtyLo(NULL), dirtyHi(NULL), shadow(NULL), pageSum(NULL),
+  front(NULL), transport(NULL), doneCallback(NULL), wireChunk(WIRE_MAX),
+  cmdOut(0), busSession(0), bandPages(0), framePeriod(0), coalescedCalls(0),
+  fps(0), framePending(false),
   mosiPin(-1), clkPin(-1), dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin) {
 #ifdef SPI_HAS_TRANSACTION
   spiSettings = SPISettings(bitrate, MSBFIRST, SPI_MODE0);
 #endif
 }
+#endif
 
+#if !defined(SSD1306_NO_SOFTSPI)
 /*!
     @brief  DEPRECATED constructor for SPI SSD1306 displays, using software
             (bitbang) SPI. Provided for older code to maintain compatibility
@@ -271,10 +381,16 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass *spi,
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin,
   int8_t dc_pin, int8_t rst_pin, int8_t cs_pin) :
   Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(NULL), wire(NULL),
-  buffer(NULL), mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin),
-  csPin(cs_pin), rstPin(rst_pin) {
+  buffer(NULL), dirtyLo(NULL), dirtyHi(NULL), shadow(NULL), pageSum(NULL),
+  front(NULL), transport(NULL), doneCallback(NULL), wireChunk(WIRE_MAX),
+  cmdOut(0), busSession(0), bandPages(0), framePeriod(0), coalescedCalls(0),
+  fps(0), framePending(false),
+  mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin), csPin(cs_pin),
+  rstPin(rst_pin) {
 }
+#endif
 
+#if !defined(SSD1306_NO_HWSPI)
 /*!
     @brief  DEPRECATED constructor for SPI SSD1306 displays, using native
             hardware SPI. Provided for older code to maintain compatibility
@@ -298,13 +414,19 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin,
 */
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin,
   int8_t cs_pin) : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT),
-  spi(&SPI), wire(NULL), buffer(NULL), mosiPin(-1), clkPin(-1),
+  spi(&SPI), wire(NULL), buffer(NULL), dirtyLo(NULL), dirtyHi(NULL),
+  shadow(NULL), pageSum(NULL), front(NULL), transport(NULL),
+  doneCallback(NULL), wireChunk(WIRE_MAX),
+  cmdOut(0), busSession(0), bandPages(0), framePeriod(0), coalescedCalls(0),
+  fps(0), framePending(false), mosiPin(-1), clkPin(-1),
   dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin) {
 #ifdef SPI_HAS_TRANSACTION
   spiSettings = SPISettings(8000000, MSBFIRST, SPI_MODE0);
 #endif
 }
+#endif
 
+#if !defined(SSD1306_NO_I2C)
 /*!
     @brief  DEPRECATED constructor for I2C SSD1306 displays. Provided for
             older code to maintain compatibility with the current library.
@@ -321,41 +443,123 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin,
 */
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t rst_pin) :
   Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(NULL), wire(&Wire),
-  buffer(NULL), mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1),
-  rstPin(rst_pin) {
+  buffer(NULL), dirtyLo(NULL), dirtyHi(NULL), shadow(NULL), pageSum(NULL),
+  front(NULL), transport(NULL), doneCallback(NULL), wireChunk(WIRE_MAX),
+  cmdOut(0), busSession(0), bandPages(0), framePeriod(0), coalescedCalls(0),
+  fps(0), framePending(false),
+  mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1), rstPin(rst_pin) {
 }
+#endif
 
 /*!
     @brief  Destructor for Adafruit_SSD1306 object.
 */
 Adafruit_SSD1306::~Adafruit_SSD1306(void) {
   if(buffer) {
-    free(buffer);
-    buffer = NULL;
+    free(buffer); // Dirty-span arrays share the same allocation
+    buffer  = NULL;
+    dirtyLo = dirtyHi = NULL;
   }
+  setDiffMode(SSD1306_DIFF_NONE); // Frees shadow or checksums, if any
+  free(front);
 }
 
 // LOW-LEVEL UTILS ---------------------------------------------------------
 
-// Issue single byte out SPI, either soft or hardware as appropriate.
+// Issue n bytes from RAM out software (bitbang) SPI, MSB first.
 // SPI transaction/selection must be performed in calling function.
-inline void Adafruit_SSD1306::SPIwrite(uint8_t d) {
-  if(spi) {
-    (void)spi->transfer(d);
-  } else {
-    for(uint8_t bit = 0x80; bit; bit >>= 1) {
+// With direct port access, the port pointers and set/clear masks are
+// copied to locals once per block so they stay in registers, and each
+// byte is fully unrolled: per bit, one read-modify-write of the MOSI port
+// (set or clear), then two of the clock port (high, low), with no loop
+// counter or shifting. The SSD1306 samples MOSI on the rising edge and
+// its minimum clock period (100 ns) is well under what this can produce.
+// Cycle accounting for AVR, by instruction timings rather than measured:
+// each read-modify-write through a pointer is LD, OR or AND, ST (5
+// cycles), and the bit test and branch add about 3, so a bit is about 18
+// cycles, a byte 144 (9 us at 16 MHz) and a 128x64 frame about 9.2 ms.
+// The host test (test/test_softspi.cpp) checks the three writes per bit.
+#ifdef HAVE_PORTREG
+ #define SOFTSPI_BIT(b)                \
+  if(d & (b)) *mosi |= mosiSet;        \
+  else        *mosi &= mosiClr;        \
+  *clk |= clkSet;                      \
+  *clk &= clkClr ///< Clock out one bit of d
+#endif
+void Adafruit_SSD1306::softSPIwriteBlock(const uint8_t *ptr, uint16_t n) {
 #ifdef HAVE_PORTREG
-      if(d & bit) *mosiPort |=  mosiPinMask;
-      else        *mosiPort &= ~mosiPinMask;
-      *clkPort |=  clkPinMask; // Clock high
-      *clkPort &= ~clkPinMask; // Clock low
+  PortReg *mosi    = mosiPort,     *clk    = clkPort;
+  PortMask mosiSet = mosiPinMask,   clkSet = clkPinMask;
+  PortMask mosiClr = ~mosiPinMask,  clkClr = ~clkPinMask;
+  while(n--) {
+    uint8_t d = *ptr++;
+    SOFTSPI_BIT(0x80); SOFTSPI_BIT(0x40); SOFTSPI_BIT(0x20);
+    SOFTSPI_BIT(0x10); SOFTSPI_BIT(0x08); SOFTSPI_BIT(0x04);
+    SOFTSPI_BIT(0x02); SOFTSPI_BIT(0x01);
+  }
 #else
+  while(n--) {
+    uint8_t d = *ptr++;
+    for(uint8_t bit = 0x80; bit; bit >>= 1) {
       digitalWrite(mosiPin, d & bit);
       digitalWrite(clkPin , HIGH);
       digitalWrite(clkPin , LOW);
+    }
+  }
 #endif
+}
+
+// Issue n bytes from RAM out SPI, soft or hardware. This is the only
+// place SPI output picks between the two, once per transfer (a command,
+// command list or window of data) rather than per byte; the byte loops
+// below and in softSPIwriteBlock() are free of it. Hardware SPI uses the
+// core's block transfer where available, which keeps the bus busy rather
+// than leaving a gap after every byte. Where that transfer also stores
+// received bytes, the data goes through a small bounce buffer so the
+// source isn't overwritten. SPI transaction/selection must be performed
+// in calling function.
+void Adafruit_SSD1306::SPIwriteBlock(const uint8_t *ptr, uint16_t n) {
+  if(USE_HWSPI) {
+#if defined(ESP32) || defined(ESP8266)
+    spi->writeBytes((uint8_t *)ptr, n);
+#elif (defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)) || \
+      defined(TEENSYDUINO)
+    spi->transfer(ptr, NULL, n); // Separate RX buffer, NULL to discard
+#elif defined(SPI_HAS_TRANSACTION) && !defined(ARDUINO_STM32_FEATHER)
+    uint8_t bounce[SPI_BOUNCE];
+    while(n) {
+      uint8_t count = (n > sizeof(bounce)) ? sizeof(bounce) : n;
+      memcpy(bounce, ptr, count);
+      spi->transfer(bounce, count);
+      ptr += count;
+      n   -= count;
     }
+#else // Older SPI lib (or WICED) without block transfer
+    while(n--) (void)spi->transfer(*ptr++);
+#endif
+  } else {
+    softSPIwriteBlock(ptr, n);
+  }
+}
+
+// Queue a command byte for I2C. Consecutive commands share a transmission
+// (up to wireChunk bytes, incl. control byte) rather than each having
+// their own, which is sent once full, when data follows, or at the end
+// of the transaction. Transaction must be started in calling function.
+void Adafruit_SSD1306::wireCommand(uint8_t c) {
+  if(cmdOut >= wireChunk) wireFlush();
+  if(!cmdOut) {
+    WIRE_BEGIN(0x00); // Co = 0, D/C = 0
+    cmdOut = 1;
   }
+  WIRE_WRITE(c);
+  cmdOut++;
+}
+
+// End the I2C transmission holding queued commands.
+void Adafruit_SSD1306::wireFlush(void) {
+  WIRE_END(cmdOut);
+  cmdOut = 0;
 }
 
 // Issue single command to SSD1306, using I2C or hard/soft SPI as needed.
@@ -363,39 +567,75 @@ inline void Adafruit_SSD1306::SPIwrite(uint8_t d) {
 // must be started/ended in calling function for efficiency.
 // This is a private function, not exposed (see ssd1306_command() instead).
 void Adafruit_SSD1306::ssd1306_command1(uint8_t c) {
-  if(wire) { // I2C
-    wire->beginTransmission(i2caddr);
-    WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
-    WIRE_WRITE(c);
-    wire->endTransmission();
+  STAT_TIMER;
+  TRACE(SSD1306_TRACE_COMMAND_BEGIN, 1);
+  if(USE_WIRE) { // I2C
+    wireCommand(c);
   } else { // SPI (hw or soft) -- transaction started in calling function
     SSD1306_MODE_COMMAND
-    SPIwrite(c);
+    SPIwriteBlock(&c, 1);
   }
+  STAT_ADD(commandBytes, 1);
+  STAT_ADD(bytes, 1);
+  TRACE(SSD1306_TRACE_COMMAND_END, 1);
+  STAT_TIME(commandMicros);
 }
 
 // Issue list of commands to SSD1306, same rules as above re: transactions.
 // This is a private function, not exposed.
 void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
-  if(wire) { // I2C
-    wire->beginTransmission(i2caddr);
-    WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
-    uint8_t bytesOut = 1;
-    while(n--) {
-      if(bytesOut >= WIRE_MAX) {
-        wire->endTransmission();
-        wire->beginTransmission(i2caddr);
-        WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
-        bytesOut = 1;
-      }
-      WIRE_WRITE(pgm_read_byte(c++));
-      bytesOut++;
+  STAT_TIMER;
+  STAT_ADD(commandBytes, n);
+  STAT_ADD(bytes, n);
+#if defined(SSD1306_ENABLE_TRACE)
+  uint8_t count = n;
+#endif
+  TRACE(SSD1306_TRACE_COMMAND_BEGIN, n);
+  if(USE_WIRE) { // I2C
+    while(n--) wireCommand(pgm_read_byte(c++));
+  } else { // SPI -- transaction started in calling function
+    SSD1306_MODE_COMMAND
+    // Copied from PROGMEM for block writes. Sized to take the library's
+    // longest list in one go, so a list is normally a single transfer.
+    uint8_t buf[16];
+    while(n) {
+      uint8_t len = (n > sizeof(buf)) ? sizeof(buf) : n;
+      for(uint8_t i=0; i<len; i++) buf[i] = pgm_read_byte(c++);
+      SPIwriteBlock(buf, len);
+      n -= len;
     }
-    wire->endTransmission();
+  }
+  TRACE(SSD1306_TRACE_COMMAND_END, count);
+  STAT_TIME(commandMicros);
+}
+
+// Set the SSD1306's page and column address window, so subsequent data
+// bytes fill pages page1 to page2 between columns col1 and col2 inclusive.
+// Same rules as above re: transactions. This is a private function.
+void Adafruit_SSD1306::ssd1306_window(uint8_t page1, uint8_t page2,
+  uint8_t col1, uint8_t col2) {
+  STAT_TIMER;
+  uint8_t cmd[] = { SSD1306_PAGEADDR, page1, page2,
+                    SSD1306_COLUMNADDR, col1, col2 };
+  TRACE(SSD1306_TRACE_COMMAND_BEGIN, sizeof(cmd));
+  if(USE_WIRE) { // I2C
+    for(uint8_t i=0; i<sizeof(cmd); i++) wireCommand(cmd[i]);
   } else { // SPI -- transaction started in calling function
     SSD1306_MODE_COMMAND
-    while(n--) SPIwrite(pgm_read_byte(c++));
+    SPIwriteBlock(cmd, sizeof(cmd));
   }
+  STAT_ADD(commandBytes, sizeof(cmd));
+  STAT_ADD(bytes, sizeof(cmd));
+  TRACE(SSD1306_TRACE_COMMAND_END, sizeof(cmd));
+  STAT_TIME(commandMicros);
+}
+
+// Flag the entire buffer as changed, e.g. when display RAM contents are
+// unknown or the buffer may have been modified outside the library.
+void Adafruit_SSD1306::dirtyAll(void) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+  memset(dirtyLo, 0        , pages);
+  memset(dirtyHi, WIDTH - 1, pages);
 }
 
 // A public version of ssd1306_command1(), for existing user code that
@@ -414,6 +654,34 @@ void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
   TRANSACTION_END
 }
 
+/*!
+    @brief  Start a bus session, so that a batch of library calls (e.g.
+            several ssd1306_command() calls, or drawing and display())
+            shares one bus setup: the I2C clock is changed once for the
+            whole batch rather than twice per call, or for SPI, the chip
+            stays selected and the SPI transaction open. Sessions nest;
+            each must be matched by an endBusSession().
+    @return None (void).
+    @note   Other devices on the same SPI bus must not be accessed during
+            a session. Other I2C devices may be, but at the display's clock
+            rate (see constructor's clkDuring argument).
+*/
+void Adafruit_SSD1306::beginBusSession(void) {
+  TRANSACTION_START
+}
+
+/*!
+    @brief  End a bus session started with beginBusSession(), restoring
+            the I2C clock or deselecting the SPI display if it's the
+            outermost one.
+    @return None (void).
+*/
+void Adafruit_SSD1306::endBusSession(void) {
+  if(busSession) {
+    TRANSACTION_END
+  }
+}
+
 // ALLOCATE & INIT DISPLAY -------------------------------------------------
 
 /*!
@@ -446,30 +714,70 @@ void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
             platforms where a nonstandard begin() function is available
             (e.g. a TwoWire interface on non-default pins, as can be done
             on the ESP8266 and perhaps others).
+    @param  splash
+            SSD1306_SPLASH_DRAW (default) to draw the Adafruit splash into
+            the buffer, shown on the first display() call.
+            SSD1306_SPLASH_NONE to skip it, leaving the buffer clear.
+            SSD1306_SPLASH_SEND to stream the splash from flash straight to
+            the display (which is also cleared) as part of initialization,
+            so it shows without a display() call, and leave the buffer
+            clear. The first display() then only sends what has been drawn,
+            plus the splash area to erase it. If SSD1306_NO_SPLASH is
+            defined, the splash isn't compiled in and this is ignored.
     @return true on successful allocation/init, false otherwise.
             Well-behaved code should check the return value before
             proceeding.
     @note   MUST call this function before any drawing or updates!
 */
 boolean Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, boolean reset,
-  boolean periphBegin) {
-
-  if((!buffer) && !(buffer = (uint8_t *)malloc(WIDTH * ((HEIGHT + 7) / 8))))
+  boolean periphBegin, uint8_t splash) {
+
+  // Buffer is followed by the per-page dirty-span arrays (for drawing
+  // and for the frame being sent), one byte per page each. It's already
+  // in place for Adafruit_SSD1306_Static, else allocated on first call.
+  // In page-strip mode it holds only one band of pages.
+  uint8_t pages = (HEIGHT + 7) / 8;
+  if(bandPages >= pages) bandPages = 0; // Band is whole screen anyway
+  uint8_t held = bandPages ? bandPages : pages;
+  if((!buffer) &&
+     !(buffer = (uint8_t *)malloc(WIDTH * held + 4 * pages)))
     return false;
+  bandFirst  = 0;
+  bandLast   = held - 1;
+  dirtyLo    = &buffer[WIDTH * held];
+  dirtyHi    = &dirtyLo[pages];
+  xferLo     = &dirtyHi[pages];
+  xferHi     = &xferLo[pages];
+  xferActive = false;
+#if defined(SSD1306_ENABLE_STATS)
+  resetStats();
+#endif
 
+  dirtyAll(); // Display RAM contents are unknown, first display() sends all
+  sumValid = 0;
+  skipped  = 0;
   clearDisplay();
-  if(HEIGHT > 32) {
-    drawBitmap((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
-      splash1_data, splash1_width, splash1_height, 1);
-  } else {
-    drawBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
-      splash2_data, splash2_width, splash2_height, 1);
+#if defined(SSD1306_NO_SPLASH)
+  splash = SSD1306_SPLASH_NONE;
+#else
+  // A band is drawn over on every drawBands(), so send splash instead
+  if(bandPages && (splash == SSD1306_SPLASH_DRAW))
+    splash = SSD1306_SPLASH_SEND;
+  if(splash == SSD1306_SPLASH_DRAW) {
+    if(HEIGHT > 32) {
+      blit((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
+        splash1_data, splash1_width, splash1_height);
+    } else {
+      blit((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
+        splash2_data, splash2_width, splash2_height);
+    }
   }
+#endif
 
   vccstate = vcs;
 
   // Setup pin directions
-  if(wire) { // Using I2C
+  if(USE_WIRE) { // Using I2C
     // If I2C address is unspecified, use default
     // (0x3C for 32-pixel-tall displays, 0x3D for all others).
     i2caddr = addr ? addr : ((HEIGHT == 32) ? 0x3C : 0x3D);
@@ -488,7 +796,7 @@ boolean Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, boolean reset,
     csPinMask = digitalPinToBitMask(csPin);
 #endif
     SSD1306_DESELECT
-    if(spi) { // Hardware SPI
+    if(USE_HWSPI) { // Hardware SPI
       // SPI peripheral begin same as wire check above.
       if(periphBegin) spi->begin();
     } else {  // Soft SPI
@@ -577,10 +885,37 @@ boolean Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, boolean reset,
     SSD1306_NORMALDISPLAY,               // 0xA6
     SSD1306_DEACTIVATE_SCROLL,
     SSD1306_DISPLAYON };                 // Main screen turn on
-  ssd1306_commandList(init5, sizeof(init5));
+  // If sending the splash, hold off on display on until it's in place
+  boolean send = (splash == SSD1306_SPLASH_SEND);
+  ssd1306_commandList(init5, sizeof(init5) - send);
 
   TRANSACTION_END
 
+#if !defined(SSD1306_NO_SPLASH)
+  if(send) {
+    // Splash image's page-major RLE data, centered. Rest of the screen is
+    // cleared to match the buffer, so only the splash area is then stale.
+    const uint8_t *data = splash1_rle_data;
+    uint8_t        w = splash1_width, h = splash1_height,
+                   n = splash1_pages;
+    if(HEIGHT <= 32) {
+      data = splash2_rle_data;
+      w    = splash2_width;
+      h    = splash2_height;
+      n    = splash2_pages;
+    }
+    int16_t x = (WIDTH - w) / 2, page = ((HEIGHT - h) / 2) / 8;
+    sendPageImageInternal(x, page, data, w, n, true, true);
+    memset(dirtyLo, 0xFF, pages);
+    memset(dirtyHi, 0x00, pages);
+    for(uint8_t row = max(page, (int16_t)0);
+      (row < pages) && (row < (page + n)); row++) {
+      staleSpan(row, max(x, (int16_t)0), min(x + w, (int)WIDTH) - 1);
+    }
+    ssd1306_command(SSD1306_DISPLAYON);
+  }
+#endif
+
   return true; // Success
 }
 
@@ -618,11 +953,14 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
       y = HEIGHT - y - 1;
       break;
     }
+    if(((y / 8) < bandFirst) || ((y / 8) > bandLast)) return; // Not in band
+    uint16_t i = x + (y / 8 - bandFirst) * WIDTH;
     switch(color) {
-     case SSD1306_WHITE:   buffer[x + (y/8)*WIDTH] |=  (1 << (y&7)); break;
-     case SSD1306_BLACK:   buffer[x + (y/8)*WIDTH] &= ~(1 << (y&7)); break;
-     case SSD1306_INVERSE: buffer[x + (y/8)*WIDTH] ^=  (1 << (y&7)); break;
+     case SSD1306_WHITE:   buffer[i] |=  (1 << (y&7)); break;
+     case SSD1306_BLACK:   buffer[i] &= ~(1 << (y&7)); break;
+     case SSD1306_INVERSE: buffer[i] ^=  (1 << (y&7)); break;
     }
+    dirtySpan(y / 8, x, x);
   }
 }
 
@@ -634,7 +972,18 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
             commands as needed by one's own application.
 */
 void Adafruit_SSD1306::clearDisplay(void) {
-  memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+  // Only columns currently holding set pixels will change, so expand
+  // each page's dirty span to cover those rather than the whole page.
+  uint8_t pages = bandLast - bandFirst + 1, *pBuf = buffer;
+  for(uint8_t page=bandFirst; page<=bandLast; page++, pBuf += WIDTH) {
+    int16_t x1 = 0, x2 = WIDTH - 1;
+    while((x1 <= x2) && !pBuf[x1]) x1++;
+    if(x1 <= x2) { // Page isn't already blank
+      while(!pBuf[x2]) x2--;
+      dirtySpan(page, x1, x2);
+    }
+  }
+  memset(buffer, 0, WIDTH * pages);
 }
 
 /*!
@@ -686,7 +1035,8 @@ void Adafruit_SSD1306::drawFastHLine(
 void Adafruit_SSD1306::drawFastHLineInternal(
   int16_t x, int16_t y, int16_t w, uint16_t color) {
 
-  if((y >= 0) && (y < HEIGHT)) { // Y coord in bounds?
+  // Y coord in bounds, and in the pages held in the buffer?
+  if((y >= (bandFirst * 8)) && (y < HEIGHT) && ((y / 8) <= bandLast)) {
     if(x < 0) { // Clip left
       w += x;
       x  = 0;
@@ -695,7 +1045,8 @@ void Adafruit_SSD1306::drawFastHLineInternal(
       w = (WIDTH - x);
     }
     if(w > 0) { // Proceed only if width is positive
-      uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x],
+      dirtySpan(y / 8, x, x + w - 1);
+      uint8_t *pBuf = &buffer[(y / 8 - bandFirst) * WIDTH + x],
                mask = 1 << (y & 7);
       switch(color) {
        case SSD1306_WHITE:               while(w--) { *pBuf++ |= mask; }; break;
@@ -756,18 +1107,25 @@ void Adafruit_SSD1306::drawFastVLineInternal(
   int16_t x, int16_t __y, int16_t __h, uint16_t color) {
 
   if((x >= 0) && (x < WIDTH)) { // X coord in bounds?
-    if(__y < 0) { // Clip top
-      __h += __y;
-      __y = 0;
+    // Clip to the pages held in the buffer (all of them, unless drawing
+    // a band in page-strip mode)
+    int16_t top = bandFirst * 8, bottom = min((bandLast + 1) * 8, (int)HEIGHT);
+    if(__y < top) { // Clip top
+      __h -= top - __y;
+      __y  = top;
     }
-    if((__y + __h) > HEIGHT) { // Clip bottom
-      __h = (HEIGHT - __y);
+    if((__y + __h) > bottom) { // Clip bottom
+      __h = (bottom - __y);
     }
     if(__h > 0) { // Proceed only if height is now positive
       // this display doesn't need ints for coordinates,
       // use local byte registers for faster juggling
       uint8_t  y = __y, h = __h;
-      uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x];
+      uint8_t *pBuf = &buffer[(y / 8 - bandFirst) * WIDTH + x];
+
+      for(uint8_t page = y / 8; page <= (y + h - 1) / 8; page++) {
+        dirtySpan(page, x, x);
+      }
 
       // do the first partial byte, if necessary - this requires some masking
       uint8_t mod = (y & 7);
@@ -835,6 +1193,143 @@ void Adafruit_SSD1306::drawFastVLineInternal(
   } // endif x in bounds
 }
 
+/*!
+    @brief  Fill a rectangle. Overrides the Adafruit_GFX version (which
+            draws one vertical line per column) to clip and rotate just
+            once, then fill the buffer a page (8 rows) at a time.
+    @param  x
+            Leftmost column -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Topmost row -- 0 at top to (screen height - 1) at bottom.
+    @param  w
+            Width of rectangle, in pixels.
+    @param  h
+            Height of rectangle, in pixels.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application. As with
+            Adafruit_GFX, a zero or negative width or height draws nothing.
+*/
+void Adafruit_SSD1306::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+  if((w <= 0) || (h <= 0)) return; // Nothing to fill, as in Adafruit_GFX
+  if(x < 0) { // Clip to screen, in rotated coordinates
+    w += x;
+    x  = 0;
+  }
+  if(y < 0) {
+    h += y;
+    y  = 0;
+  }
+  if((x + w) > width())  w = width()  - x;
+  if((y + h) > height()) h = height() - y;
+  if((w <= 0) || (h <= 0)) return;
+
+  switch(rotation) {
+   case 1:
+    // 90 degree rotation, swap x & y (and w & h), then invert x
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    x = WIDTH - x - w;
+    break;
+   case 2:
+    // 180 degree rotation, invert x and y
+    x = WIDTH  - x - w;
+    y = HEIGHT - y - h;
+    break;
+   case 3:
+    // 270 degree rotation, swap x & y (and w & h), then invert y
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+  fillRectInternal(x, y, w, h, color);
+}
+
+/*!
+    @brief  Fill a rectangle, as used by the Adafruit_GFX library within
+            startWrite()/endWrite() pairs. Same as fillRect().
+    @param  x
+            Leftmost column -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Topmost row -- 0 at top to (screen height - 1) at bottom.
+    @param  w
+            Width of rectangle, in pixels.
+    @param  h
+            Height of rectangle, in pixels.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306::writeFillRect(int16_t x, int16_t y, int16_t w,
+  int16_t h, uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+/*!
+    @brief  Fill the whole screen with one color.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application.
+*/
+void Adafruit_SSD1306::fillScreen(uint16_t color) {
+  if(color == SSD1306_BLACK) clearDisplay(); // Only marks lit columns dirty
+  else                       fillRectInternal(0, 0, WIDTH, HEIGHT, color);
+}
+
+// Fill a rectangle given in unrotated, already-clipped coordinates. Each
+// page it covers gets a single mask: the top and bottom pages may be
+// partial, pages in between are whole bytes. Whole-byte runs are stored
+// with memset() (or a word-at-a-time XOR for SSD1306_INVERSE).
+void Adafruit_SSD1306::fillRectInternal(uint8_t x, uint8_t y, uint8_t w,
+  uint8_t h, uint16_t color) {
+  int16_t top = max((int16_t)y, (int16_t)(bandFirst * 8)), // Clip to band
+          bottom = min(y + h, (bandLast + 1) * 8);
+  if(top >= bottom) return;
+  y = top;
+  h = bottom - top;
+  uint8_t page1 = y / 8, page2 = (y + h - 1) / 8;
+  uint8_t *pBuf = &buffer[(page1 - bandFirst) * WIDTH + x];
+  for(uint8_t page=page1; page<=page2; page++, pBuf += WIDTH) {
+    uint8_t mask = 0xFF;
+    if(page == page1) mask &= 0xFF << (y & 7);
+    if(page == page2) mask &= 0xFF >> (7 - ((y + h - 1) & 7));
+    dirtySpan(page, x, x + w - 1);
+    uint8_t *ptr = pBuf, n = w;
+    if(mask == 0xFF) {
+      switch(color) {
+       case SSD1306_WHITE: memset(ptr, 0xFF, n); break;
+       case SSD1306_BLACK: memset(ptr, 0x00, n); break;
+       case SSD1306_INVERSE:
+        for(; n && ((uintptr_t)ptr & (sizeof(ssd1306_word) - 1)); n--)
+          *ptr++ ^= 0xFF;
+        for(; n >= sizeof(ssd1306_word); n -= sizeof(ssd1306_word)) {
+          *(ssd1306_word *)ptr ^= ~(ssd1306_word)0;
+          ptr += sizeof(ssd1306_word);
+        }
+        while(n--) *ptr++ ^= 0xFF;
+        break;
+      }
+    } else {
+      switch(color) {
+       case SSD1306_WHITE:               while(n--) *ptr++ |= mask; break;
+       case SSD1306_BLACK: mask = ~mask; while(n--) *ptr++ &= mask; break;
+       case SSD1306_INVERSE:             while(n--) *ptr++ ^= mask; break;
+      }
+    }
+  }
+}
+
 /*!
     @brief  Return color of a single pixel in display buffer.
     @param  x
@@ -863,7 +1358,8 @@ boolean Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
       y = HEIGHT - y - 1;
       break;
     }
-    return (buffer[x + (y / 8) * WIDTH] & (1 << (y & 7)));
+    if(((y / 8) < bandFirst) || ((y / 8) > bandLast)) return false;
+    return (buffer[x + (y / 8 - bandFirst) * WIDTH] & (1 << (y & 7)));
   }
   return false; // Pixel out of bounds
 }
@@ -872,155 +1368,1550 @@ boolean Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
     @brief  Get base address of display buffer for direct reading or writing.
     @return Pointer to an unsigned 8-bit array, column-major, columns padded
             to full byte boundary if needed.
+    @note   Since the library can't know what is written through this
+            pointer, every call flags the whole buffer as changed and the
+            next display() call will send the full screen (less whatever
+            setDiffMode() finds unchanged). Code that only reads the buffer
+            should use getBufferReadOnly() instead, which leaves change
+            tracking alone. In page-strip mode (see setBandHeight()) the
+            buffer holds only the current band.
 */
 uint8_t *Adafruit_SSD1306::getBuffer(void) {
+  if(buffer) dirtyAll();
   return buffer;
 }
 
-// REFRESH DISPLAY ---------------------------------------------------------
-
 /*!
-    @brief  Push data currently in RAM to SSD1306 display.
-    @return None (void).
-    @note   Drawing operations are not visible until this function is
-            called. Call after each graphics command, or after a whole set
-            of graphics commands, as best needed by one's own application.
+    @brief  Get base address of display buffer for reading only. Unlike
+            getBuffer(), this does not flag the buffer as changed, so it's
+            cheap to call every frame.
+    @return Pointer to the buffer, same layout as getBuffer(), or NULL if
+            begin() has not been called.
 */
-void Adafruit_SSD1306::display(void) {
-  TRANSACTION_START
-  static const uint8_t PROGMEM dlist1[] = {
-    SSD1306_PAGEADDR,
-    0,                         // Page start address
-    0xFF,                      // Page end (not really, but works here)
-    SSD1306_COLUMNADDR,
-    0 };                       // Column start address
-  ssd1306_commandList(dlist1, sizeof(dlist1));
-  ssd1306_command1(WIDTH - 1); // Column end address
+const uint8_t *Adafruit_SSD1306::getBufferReadOnly(void) {
+  return buffer;
+}
 
-#if defined(ESP8266)
-  // ESP8266 needs a periodic yield() call to avoid watchdog reset.
-  // With the limited size of SSD1306 displays, and the fast bitrate
-  // being used (1 MHz or more), I think one yield() immediately before
-  // a screen write and one immediately after should cover it.  But if
-  // not, if this becomes a problem, yields() might be added in the
-  // 32-byte transfer condition below.
-  yield();
-#endif
-  uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-  uint8_t *ptr   = buffer;
-  if(wire) { // I2C
-    wire->beginTransmission(i2caddr);
-    WIRE_WRITE((uint8_t)0x40);
-    uint8_t bytesOut = 1;
-    while(count--) {
-      if(bytesOut >= WIRE_MAX) {
-        wire->endTransmission();
-        wire->beginTransmission(i2caddr);
-        WIRE_WRITE((uint8_t)0x40);
-        bytesOut = 1;
-      }
-      WIRE_WRITE(*ptr++);
-      bytesOut++;
-    }
-    wire->endTransmission();
-  } else { // SPI
-    SSD1306_MODE_DATA
-    while(count--) SPIwrite(*ptr++);
+// BITMAP BLITTING ---------------------------------------------------------
+
+// Apply raster operation rop to the bits of *d selected by m, taking
+// source bits from v.
+static inline void rasterOp(uint8_t *d, uint8_t v, uint8_t m, uint8_t rop) {
+  switch(rop) {
+   case SSD1306_ROP_COPY:  *d = (*d & ~m) | (v & m); break;
+   case SSD1306_ROP_OR:    *d |=  (v & m);          break;
+   case SSD1306_ROP_AND:   *d &= ~(~v & m);         break;
+   case SSD1306_ROP_XOR:   *d ^=  (v & m);          break;
+   case SSD1306_ROP_CLEAR: *d &= ~(v & m);          break;
   }
-  TRANSACTION_END
-#if defined(ESP8266)
-  yield();
-#endif
 }
 
-// SCROLLING FUNCTIONS -----------------------------------------------------
+// Reverse the bit order of a byte.
+static inline uint8_t reverseBits(uint8_t b) {
+  b = ((b & 0xF0) >> 4) | ((b & 0x0F) << 4);
+  b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
+  return ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
+}
+
+// Transpose 8 row-major bitmap bytes (MSB leftmost) into 8 page-major
+// column bytes: bit n of cols[k] is pixel k of rows[n].
+static void transpose8(const uint8_t *rows, uint8_t *cols) {
+  memset(cols, 0, 8);
+  for(uint8_t n=0; n<8; n++) {
+    uint8_t b = rows[n];
+    if(!b) continue; // Blank rows are common in icons & text
+    for(uint8_t k=0, bit=1<<n; k<8; k++, b <<= 1) {
+      if(b & 0x80) cols[k] |= bit;
+    }
+  }
+}
 
 /*!
-    @brief  Activate a right-handed scroll for all or part of the display.
-    @param  start
-            First row.
-    @param  stop
-            Last row.
+    @brief  Draw a 1-bit bitmap from PROGMEM, in the same format as
+            Adafruit_GFX's drawBitmap() (rows of bytes, MSB leftmost, each
+            row padded to a whole byte), combining it with the buffer
+            contents using a raster operation. Rather than plotting pixel
+            by pixel, source bytes are converted to the display's
+            page-major layout 8x8 bits at a time, so this is much faster
+            than drawBitmap() for anything but tiny images.
+    @param  x
+            Leftmost column -- may be off screen, image is clipped.
+    @param  y
+            Topmost row -- may be off screen, image is clipped.
+    @param  bitmap
+            Bitmap data in PROGMEM.
+    @param  w
+            Width of bitmap, in pixels.
+    @param  h
+            Height of bitmap, in pixels.
+    @param  rop
+            Raster operation, one of SSD1306_ROP_COPY, SSD1306_ROP_OR (the
+            default -- same as drawBitmap() in SSD1306_WHITE),
+            SSD1306_ROP_AND, SSD1306_ROP_XOR or SSD1306_ROP_CLEAR.
     @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application.
 */
-// To scroll the whole display, run: display.startscrollright(0x00, 0x0F)
-void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) {
-  TRANSACTION_START
-  static const uint8_t PROGMEM scrollList1a[] = {
-    SSD1306_RIGHT_HORIZONTAL_SCROLL,
-    0X00 };
-  ssd1306_commandList(scrollList1a, sizeof(scrollList1a));
-  ssd1306_command1(start);
-  ssd1306_command1(0X00);
-  ssd1306_command1(stop);
-  static const uint8_t PROGMEM scrollList1b[] = {
-    0X00,
-    0XFF,
-    SSD1306_ACTIVATE_SCROLL };
-  ssd1306_commandList(scrollList1b, sizeof(scrollList1b));
-  TRANSACTION_END
+void Adafruit_SSD1306::blit(int16_t x, int16_t y, const uint8_t bitmap[],
+  int16_t w, int16_t h, uint8_t rop) {
+  blitInternal(x, y, bitmap, NULL, w, h, rop, true);
 }
 
 /*!
-    @brief  Activate a left-handed scroll for all or part of the display.
-    @param  start
-            First row.
-    @param  stop
-            Last row.
+    @brief  Draw a 1-bit bitmap from RAM, see the PROGMEM version above.
+    @param  x
+            Leftmost column -- may be off screen, image is clipped.
+    @param  y
+            Topmost row -- may be off screen, image is clipped.
+    @param  bitmap
+            Bitmap data in RAM.
+    @param  w
+            Width of bitmap, in pixels.
+    @param  h
+            Height of bitmap, in pixels.
+    @param  rop
+            Raster operation, see above.
     @return None (void).
 */
-// To scroll the whole display, run: display.startscrollleft(0x00, 0x0F)
-void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop) {
-  TRANSACTION_START
-  static const uint8_t PROGMEM scrollList2a[] = {
-    SSD1306_LEFT_HORIZONTAL_SCROLL,
-    0X00 };
-  ssd1306_commandList(scrollList2a, sizeof(scrollList2a));
-  ssd1306_command1(start);
-  ssd1306_command1(0X00);
-  ssd1306_command1(stop);
-  static const uint8_t PROGMEM scrollList2b[] = {
-    0X00,
-    0XFF,
-    SSD1306_ACTIVATE_SCROLL };
-  ssd1306_commandList(scrollList2b, sizeof(scrollList2b));
-  TRANSACTION_END
+void Adafruit_SSD1306::blit(int16_t x, int16_t y, uint8_t *bitmap,
+  int16_t w, int16_t h, uint8_t rop) {
+  blitInternal(x, y, bitmap, NULL, w, h, rop, false);
 }
 
 /*!
-    @brief  Activate a diagonal scroll for all or part of the display.
-    @param  start
-            First row.
-    @param  stop
-            Last row.
+    @brief  Draw a 1-bit bitmap from PROGMEM through a mask: where the mask
+            is set, pixels are set or cleared to match the bitmap, and
+            elsewhere left as they were. This suits sprites and icons with
+            a transparent background. Same format and speed as blit().
+    @param  x
+            Leftmost column -- may be off screen, image is clipped.
+    @param  y
+            Topmost row -- may be off screen, image is clipped.
+    @param  bitmap
+            Bitmap data in PROGMEM.
+    @param  mask
+            Mask data in PROGMEM, same size and format as bitmap.
+    @param  w
+            Width of bitmap, in pixels.
+    @param  h
+            Height of bitmap, in pixels.
     @return None (void).
 */
-// display.startscrolldiagright(0x00, 0x0F)
-void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop) {
-  TRANSACTION_START
-  static const uint8_t PROGMEM scrollList3a[] = {
-    SSD1306_SET_VERTICAL_SCROLL_AREA,
-    0X00 };
-  ssd1306_commandList(scrollList3a, sizeof(scrollList3a));
-  ssd1306_command1(HEIGHT);
-  static const uint8_t PROGMEM scrollList3b[] = {
-    SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL,
-    0X00 };
-  ssd1306_commandList(scrollList3b, sizeof(scrollList3b));
-  ssd1306_command1(start);
-  ssd1306_command1(0X00);
-  ssd1306_command1(stop);
-  static const uint8_t PROGMEM scrollList3c[] = {
-    0X01,
-    SSD1306_ACTIVATE_SCROLL };
-  ssd1306_commandList(scrollList3c, sizeof(scrollList3c));
-  TRANSACTION_END
+void Adafruit_SSD1306::blitMasked(int16_t x, int16_t y,
+  const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h) {
+  blitInternal(x, y, bitmap, mask, w, h, SSD1306_ROP_COPY, true);
 }
 
 /*!
-    @brief  Activate alternate diagonal scroll for all or part of the display.
-    @param  start
-            First row.
+    @brief  Draw a 1-bit bitmap from RAM through a mask, see the PROGMEM
+            version above.
+    @param  x
+            Leftmost column -- may be off screen, image is clipped.
+    @param  y
+            Topmost row -- may be off screen, image is clipped.
+    @param  bitmap
+            Bitmap data in RAM.
+    @param  mask
+            Mask data in RAM, same size and format as bitmap.
+    @param  w
+            Width of bitmap, in pixels.
+    @param  h
+            Height of bitmap, in pixels.
+    @return None (void).
+*/
+void Adafruit_SSD1306::blitMasked(int16_t x, int16_t y, uint8_t *bitmap,
+  uint8_t *mask, int16_t w, int16_t h) {
+  blitInternal(x, y, bitmap, mask, w, h, SSD1306_ROP_COPY, false);
+}
+
+// Common code for blit() and blitMasked(). The bitmap is clipped in
+// rotated coordinates, then walked in whichever order suits the rotation:
+// - 0 and 180 degrees: source rows run along display rows, so for each
+//   display page the 8 source rows landing in it are fetched a byte
+//   (8 columns) at a time and transposed into 8 column bytes. As rows are
+//   gathered to match the page, any y offset costs no shifting.
+// - 90 and 270 degrees: source rows run down display columns, so each
+//   source byte (bit-reversed for 90 degrees) is shifted into position
+//   and applied to at most two pages of one column.
+void Adafruit_SSD1306::blitInternal(int16_t x, int16_t y,
+  const uint8_t *bitmap, const uint8_t *mask, int16_t w, int16_t h,
+  uint8_t rop, boolean progmem) {
+  // Range of source columns (i) and rows (j) that are on screen
+  int16_t i0 = (x < 0) ? -x : 0, i1 = width()  - x,
+          j0 = (y < 0) ? -y : 0, j1 = height() - y;
+  if(i1 > w) i1 = w;
+  if(j1 > h) j1 = h;
+  if((i0 >= i1) || (j0 >= j1)) return;
+
+  // Unrotated bounds of that area, marked dirty up front
+  int16_t x1, x2, y1, y2;
+  switch(rotation) {
+   default:
+    x1 = x + i0;                 x2 = x + i1 - 1;
+    y1 = y + j0;                 y2 = y + j1 - 1;
+    break;
+   case 1:
+    x1 = WIDTH  - y - j1;        x2 = WIDTH  - 1 - y - j0;
+    y1 = x + i0;                 y2 = x + i1 - 1;
+    break;
+   case 2:
+    x1 = WIDTH  - x - i1;        x2 = WIDTH  - 1 - x - i0;
+    y1 = HEIGHT - y - j1;        y2 = HEIGHT - 1 - y - j0;
+    break;
+   case 3:
+    x1 = y + j0;                 x2 = y + j1 - 1;
+    y1 = HEIGHT - x - i1;        y2 = HEIGHT - 1 - x - i0;
+    break;
+  }
+  if(y1 < (bandFirst * 8))     y1 = bandFirst * 8; // Clip to band
+  if(y2 > (bandLast * 8 + 7))  y2 = bandLast * 8 + 7;
+  if(y1 > y2) return;
+  for(uint8_t page = y1 / 8; page <= y2 / 8; page++) {
+    dirtySpan(page, x1, x2);
+  }
+
+  uint16_t bw = (w + 7) / 8; // Bytes per source row
+  uint8_t  bx0 = i0 / 8, bx1 = (i1 - 1) / 8;
+  uint8_t  b, mb = 0xFF;
+
+  if(!(rotation & 1)) {
+    uint8_t rows[8], mrows[8], cols[8], mcols[8];
+    for(uint8_t page = y1 / 8; page <= y2 / 8; page++) {
+      // Source row for each bit of this page, and which bits are valid
+      const uint8_t *src[8], *msk[8];
+      uint8_t        valid = 0;
+      for(uint8_t n=0; n<8; n++) {
+        int16_t row = page * 8 + n, j = rotation ? (HEIGHT - 1 - y - row) :
+                                                   (row - y);
+        src[n] = msk[n] = NULL;
+        if((row >= y1) && (row <= y2)) {
+          valid  |= 1 << n;
+          src[n]  = &bitmap[j * bw];
+          if(mask) msk[n] = &mask[j * bw];
+        }
+      }
+      uint8_t *pBuf = &buffer[(page - bandFirst) * WIDTH];
+      for(uint8_t bx = bx0; bx <= bx1; bx++) {
+        for(uint8_t n=0; n<8; n++) {
+          rows[n] = src[n] ? (progmem ? pgm_read_byte(&src[n][bx]) :
+                                        src[n][bx]) : 0;
+          if(mask) mrows[n] = msk[n] ? (progmem ? pgm_read_byte(&msk[n][bx]) :
+                                                  msk[n][bx]) : 0;
+        }
+        transpose8(rows, cols);
+        if(mask) transpose8(mrows, mcols);
+        for(uint8_t k=0; k<8; k++) {
+          int16_t i = bx * 8 + k;
+          if((i < i0) || (i >= i1)) continue;
+          rasterOp(&pBuf[rotation ? (WIDTH - 1 - x - i) : (x + i)], cols[k],
+            mask ? (valid & mcols[k]) : valid, rop);
+        }
+      }
+    }
+  } else {
+    for(int16_t j = j0; j < j1; j++) {
+      int16_t col = (rotation == 1) ? (WIDTH - 1 - y - j) : (y + j);
+      const uint8_t *src = &bitmap[j * bw], *msk = mask ? &mask[j * bw] : NULL;
+      for(uint8_t bx = bx0; bx <= bx1; bx++) {
+        b = progmem ? pgm_read_byte(&src[bx]) : src[bx];
+        if(mask) mb = progmem ? pgm_read_byte(&msk[bx]) : msk[bx];
+        int16_t i = bx * 8; // Clip to on-screen pixels (MSB = leftmost)
+        uint8_t m = 0xFF;
+        if(i < i0)       m &= 0xFF >> (i0 - i);
+        if((i + 8) > i1) m &= 0xFF << (i + 8 - i1);
+        m &= mb;
+        // Display row of the source byte's bit 0, maybe above the screen
+        int16_t base;
+        if(rotation == 1) {
+          b    = reverseBits(b);
+          m    = reverseBits(m);
+          base = x + i;
+        } else {
+          base = HEIGHT - 8 - x - i;
+        }
+        int8_t   page = (base + 8) / 8 - 1, shift = (base + 8) & 7;
+        uint16_t b16  = (uint16_t)b << shift, m16 = (uint16_t)m << shift;
+        if((page >= bandFirst) && (page <= bandLast) && (uint8_t)m16)
+          rasterOp(&buffer[(page - bandFirst) * WIDTH + col], b16, m16, rop);
+        if((page >= (bandFirst - 1)) && (page < bandLast) && (m16 >> 8))
+          rasterOp(&buffer[(page + 1 - bandFirst) * WIDTH + col], b16 >> 8,
+            m16 >> 8, rop);
+      }
+    }
+  }
+}
+
+// PAGE-MAJOR IMAGES -------------------------------------------------------
+
+// Reads page-major image data from PROGMEM a byte at a time, either plain
+// or run-length encoded (see scripts/make_splash.py for the format).
+struct SSD1306_ImageReader {
+  const uint8_t *src;
+  boolean        rle;
+  boolean        repeat; // Current run is one byte repeated (else literal)
+  uint8_t        left;   // Bytes left in current run
+  uint8_t        value;  // Byte being repeated
+  SSD1306_ImageReader(const uint8_t *data, boolean packed) :
+    src(data), rle(packed), repeat(false), left(0), value(0) { }
+  uint8_t next(void) {
+    if(rle) {
+      if(!left) {
+        uint8_t c = pgm_read_byte(src++);
+        if((repeat = (c & 0x80))) {
+          left  = (c & 0x7F) + 2;
+          value = pgm_read_byte(src++);
+        } else {
+          left  = c + 1;
+        }
+      }
+      left--;
+      if(repeat) return value;
+    }
+    return pgm_read_byte(src++);
+  }
+};
+
+/*!
+    @brief  Copy an image in the display's native page-major layout (as
+            generated by scripts/make_splash.py --pages or --rle) into the
+            buffer. Bytes are stored as-is, with no per-pixel conversion.
+    @param  x
+            Leftmost column, in unrotated display coordinates. Image is
+            clipped to the display.
+    @param  page
+            Topmost page (8-pixel row), in unrotated display coordinates.
+    @param  data
+            Image data in PROGMEM: w bytes for each page, LSB at top.
+    @param  w
+            Width of image, in pixels.
+    @param  pages
+            Height of image, in pages.
+    @param  rle
+            true if data is run-length encoded (make_splash.py --rle).
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application. Screen rotation
+            is not applied.
+*/
+void Adafruit_SSD1306::drawPageImage(int16_t x, int16_t page,
+  const uint8_t data[], uint8_t w, uint8_t pages, boolean rle) {
+  drawPageImageInternal(x, page, data, w, pages, rle);
+}
+
+// Common code for drawPageImage() and startAnimation(), returns the
+// address following the image data.
+const uint8_t *Adafruit_SSD1306::drawPageImageInternal(int16_t x,
+  int16_t page, const uint8_t *data, uint8_t w, uint8_t pages, boolean rle) {
+  SSD1306_ImageReader rd(data, rle);
+  int16_t x1 = max(x, (int16_t)0), x2 = min((int16_t)(x + w), WIDTH) - 1;
+  for(int16_t row = page; row < (page + pages); row++) {
+    boolean onScreen = (row >= bandFirst) && (row <= bandLast);
+    if(onScreen && (x1 <= x2)) dirtySpan(row, x1, x2);
+    for(int16_t col = x; col < (x + w); col++) {
+      uint8_t b = rd.next();
+      if(onScreen && (col >= x1) && (col <= x2))
+        buffer[(row - bandFirst) * WIDTH + col] = b;
+    }
+  }
+  return rd.src;
+}
+
+/*!
+    @brief  Send an image in the display's native page-major layout
+            straight to display RAM, decoding as it goes, without using the
+            buffer. Useful for full-screen images such as a splash, since
+            nothing needs to be drawn first.
+    @param  x
+            Leftmost column, in unrotated display coordinates. Image is
+            clipped to the display.
+    @param  page
+            Topmost page (8-pixel row), in unrotated display coordinates.
+    @param  data
+            Image data in PROGMEM: w bytes for each page, LSB at top.
+    @param  w
+            Width of image, in pixels.
+    @param  pages
+            Height of image, in pages.
+    @param  rle
+            true if data is run-length encoded (make_splash.py --rle).
+    @return None (void).
+    @note   The area is flagged as changed, so the next display() will
+            restore it from the buffer.
+*/
+void Adafruit_SSD1306::sendPageImage(int16_t x, int16_t page,
+  const uint8_t data[], uint8_t w, uint8_t pages, boolean rle) {
+  sendPageImageInternal(x, page, data, w, pages, rle, false);
+}
+
+// Common code for sendPageImage() and begin()'s SSD1306_SPLASH_SEND. The
+// window is either the on-screen part of the image or, if fill is set,
+// the whole screen, with the area around the image cleared. Either way,
+// the image is decoded in order, and bytes outside the window dropped.
+void Adafruit_SSD1306::sendPageImageInternal(int16_t x, int16_t page,
+  const uint8_t *data, uint8_t w, uint8_t pages, boolean rle, boolean fill) {
+  int16_t x1 = 0, x2 = WIDTH - 1, p1 = 0, p2 = (HEIGHT + 7) / 8 - 1;
+  if(!fill) { // Clip window to image
+    if(x > x1) x1 = x;
+    if((x + w - 1) < x2) x2 = x + w - 1;
+    if(page > p1) p1 = page;
+    if((page + pages - 1) < p2) p2 = page + pages - 1;
+    if((x1 > x2) || (p1 > p2)) return;
+  }
+  if(buffer) while(isBusy());
+
+  SSD1306_ImageReader rd(data, rle);
+  uint8_t  spiBuf[SPI_BOUNCE], spiLen = 0;
+  uint16_t bytesOut = 1, sent = 0;
+  STAT_TIMER;
+  TRANSACTION_START
+  ssd1306_window(p1, p2, x1, x2);
+  TRACE(SSD1306_TRACE_DATA_BEGIN, (p2 - p1 + 1) * (x2 - x1 + 1));
+  if(USE_WIRE) { // I2C
+    WIRE_BEGIN(0x40);
+  } else { // SPI
+    SSD1306_MODE_DATA
+  }
+  int16_t rowEnd = max((int16_t)(page + pages - 1), p2),
+          colEnd = max((int16_t)(x + w - 1), x2);
+  for(int16_t row = min(page, p1); row <= rowEnd; row++) {
+    boolean imageRow = (row >= page) && (row < (page + pages)),
+            inWindow = (row >= p1) && (row <= p2);
+    if(!inWindow) { // Skip over this row of image
+      if(imageRow) for(uint8_t i=0; i<w; i++) rd.next();
+      continue;
+    }
+    for(int16_t col = min(x, x1); col <= colEnd; col++) {
+      uint8_t b = (imageRow && (col >= x) && (col < (x + w))) ? rd.next() : 0;
+      if((col < x1) || (col > x2)) continue;
+      if(USE_WIRE) {
+        if(bytesOut >= wireChunk) {
+          WIRE_END(bytesOut);
+          WIRE_BEGIN(0x40);
+          bytesOut = 1;
+        }
+        WIRE_WRITE(b);
+        bytesOut++;
+      } else {
+        spiBuf[spiLen++] = b;
+        if(spiLen == sizeof(spiBuf)) {
+          SPIwriteBlock(spiBuf, spiLen);
+          spiLen = 0;
+        }
+      }
+      sent++;
+    }
+  }
+  if(USE_WIRE) {
+    WIRE_END(bytesOut);
+  } else {
+    SPIwriteBlock(spiBuf, spiLen);
+  }
+  TRACE(SSD1306_TRACE_DATA_END, sent);
+  TRANSACTION_END
+  STAT_ADD(dataBytes, sent);
+  STAT_ADD(bytes, sent);
+  STAT_TIME(displayMicros);
+
+  if(buffer && !fill) {
+    for(uint8_t row = p1; row <= p2; row++) staleSpan(row, x1, x2);
+  }
+}
+
+// ANIMATION ---------------------------------------------------------------
+
+/*!
+    @brief  Start playing an animation made by scripts/make_anim.py: draw
+            its first frame into the buffer and set up anim for
+            nextAnimationFrame().
+    @param  anim
+            Playback state, filled in here. One per animation playing.
+    @param  data
+            Animation data in PROGMEM (the make_anim.py "_anim" array).
+    @param  x
+            Leftmost column, in unrotated display coordinates. Animation
+            is clipped to the display.
+    @param  page
+            Topmost page (8-pixel row), in unrotated display coordinates.
+    @return None (void).
+    @note   Changes buffer contents only, follow up with display().
+*/
+void Adafruit_SSD1306::startAnimation(SSD1306_Animation &anim,
+  const uint8_t data[], int16_t x, int16_t page) {
+  uint8_t w = pgm_read_byte(&data[0]), pages = pgm_read_byte(&data[1]);
+  anim.frames = pgm_read_byte(&data[2]) | (pgm_read_byte(&data[3]) << 8);
+  anim.frame  = 0;
+  anim.x      = x;
+  anim.page   = page;
+  anim.first  = anim.next =
+    drawPageImageInternal(x, page, &data[4], w, pages, true);
+}
+
+/*!
+    @brief  Advance an animation started with startAnimation() by one
+            frame, XORing the bytes that change into the buffer. After the
+            last frame it loops back to the first.
+    @param  anim
+            Playback state.
+    @return Index of the frame now in the buffer, 0 when it has looped.
+    @note   Changes buffer contents only, follow up with display(), which
+            sends only the columns of each page that changed. The time
+            this takes thus depends on how much of the frame changes, not
+            on its size. The animation's area must not be drawn over
+            between frames, as each frame is applied as a difference from
+            the one before.
+*/
+uint16_t Adafruit_SSD1306::nextAnimationFrame(SSD1306_Animation &anim) {
+  const uint8_t *src = anim.next;
+  uint8_t        row;
+  while((row = pgm_read_byte(src)) != 0xFF) {
+    int16_t page = anim.page + row,
+            x    = anim.x + pgm_read_byte(&src[1]);
+    uint8_t n    = pgm_read_byte(&src[2]);
+    SSD1306_ImageReader rd(&src[3], true);
+    if((page >= bandFirst) && (page <= bandLast)) {
+      int16_t x1 = max(x, (int16_t)0),
+              x2 = min((int16_t)(x + n), WIDTH) - 1;
+      if(x1 <= x2) dirtySpan(page, x1, x2);
+      for(int16_t col = x; col < (x + n); col++) {
+        uint8_t b = rd.next();
+        if((col >= x1) && (col <= x2))
+          buffer[(page - bandFirst) * WIDTH + col] ^= b;
+      }
+    } else {
+      for(uint8_t i=0; i<n; i++) rd.next();
+    }
+    src = rd.src;
+  }
+  if(++anim.frame >= anim.frames) { // Last delta leads back to first frame
+    anim.frame = 0;
+    anim.next  = anim.first;
+  } else {
+    anim.next  = src + 1;
+  }
+  return anim.frame;
+}
+
+// CHANGE DETECTION --------------------------------------------------------
+
+// Display RAM was written directly in columns x1 to x2 of a page, so it
+// no longer matches the buffer there: flag them for the next display(),
+// and make sure the diff mode, if any, won't find them unchanged.
+void Adafruit_SSD1306::staleSpan(uint8_t page, uint8_t x1, uint8_t x2) {
+  dirtySpan(page, x1, x2);
+  if(shadow) { // Display RAM no longer known there, whatever it holds
+    uint8_t pages = (HEIGHT + 7) / 8, *unknownLo = &shadow[WIDTH * pages],
+           *unknownHi = &unknownLo[pages];
+    if(x1 < unknownLo[page]) unknownLo[page] = x1;
+    if(x2 > unknownHi[page]) unknownHi[page] = x2;
+  }
+  sumValid &= ~((uint32_t)1 << page);
+}
+
+// Return index of the first byte differing between a[] and b[] (n bytes
+// each), or n if identical. Compares a native word at a time when the two
+// pointers share the same word alignment (true of malloc()ed buffers).
+static uint16_t firstDiff(const uint8_t *a, const uint8_t *b, uint16_t n) {
+  uint16_t i = 0;
+  if(!(((uintptr_t)a ^ (uintptr_t)b) & (sizeof(ssd1306_word) - 1))) {
+    while((i < n) && ((uintptr_t)&a[i] & (sizeof(ssd1306_word) - 1))) {
+      if(a[i] != b[i]) return i;
+      i++;
+    }
+    while(((size_t)(n - i) >= sizeof(ssd1306_word)) &&
+      (*(const ssd1306_word *)&a[i] == *(const ssd1306_word *)&b[i])) {
+      i += sizeof(ssd1306_word);
+    }
+  }
+  while((i < n) && (a[i] == b[i])) i++;
+  return i;
+}
+
+// Return n less the number of identical trailing bytes in a[] and b[],
+// i.e. one past the last differing byte, or 0 if identical.
+static uint16_t lastDiff(const uint8_t *a, const uint8_t *b, uint16_t n) {
+  if(!(((uintptr_t)a ^ (uintptr_t)b) & (sizeof(ssd1306_word) - 1))) {
+    while(n && ((uintptr_t)&a[n] & (sizeof(ssd1306_word) - 1))) {
+      if(a[n - 1] != b[n - 1]) return n;
+      n--;
+    }
+    while((n >= sizeof(ssd1306_word)) &&
+      (*(const ssd1306_word *)&a[n - sizeof(ssd1306_word)] ==
+       *(const ssd1306_word *)&b[n - sizeof(ssd1306_word)])) {
+      n -= sizeof(ssd1306_word);
+    }
+  }
+  while(n && (a[n - 1] == b[n - 1])) n--;
+  return n;
+}
+
+// Fletcher-style checksum of one page, for SSD1306_DIFF_CHECKSUM mode.
+static uint32_t pageChecksum(const uint8_t *ptr, uint16_t n) {
+  uint16_t s1 = 0, s2 = 0;
+  while(n--) {
+    s1 += *ptr++;
+    s2 += s1;
+  }
+  return ((uint32_t)s2 << 16) | s1;
+}
+
+/*!
+    @brief  Select how display() screens changed areas of the buffer for
+            content that is actually identical to what the display already
+            shows. This matters mostly for code that writes directly into
+            getBuffer(), which flags the whole buffer as changed.
+    @param  mode
+            SSD1306_DIFF_NONE to send all changed areas as-is (default).
+            SSD1306_DIFF_SHADOW keeps a copy of the last frame sent (the
+            size of the display buffer, plus 2 bytes per page) and trims
+            each page's changed span down to the bytes that really differ.
+            SSD1306_DIFF_CHECKSUM keeps only a 4-byte checksum per page and
+            skips pages whose contents match the last one sent. Far less
+            RAM, but coarser, and a checksum collision (very unlikely)
+            would leave a stale page on screen.
+    @return true on success, false if the extra RAM could not be allocated
+            (mode reverts to SSD1306_DIFF_NONE).
+    @note   Call after begin().
+*/
+boolean Adafruit_SSD1306::setDiffMode(uint8_t mode) {
+  free(shadow);
+  free(pageSum);
+  shadow  = NULL;
+  pageSum = NULL;
+  if(!buffer || bandPages) return (mode == SSD1306_DIFF_NONE);
+
+  uint8_t pages = (HEIGHT + 7) / 8;
+  if(mode == SSD1306_DIFF_SHADOW) {
+    // Shadow copy, then per-page spans of display RAM whose contents are
+    // unknown, which the comparison must never trim (any value stored in
+    // the copy for them could happen to match what's drawn next).
+    if(!(shadow = (uint8_t *)malloc(WIDTH * pages + 2 * pages)))
+      return false;
+    // Unchanged areas of the buffer already match display RAM. Changed
+    // areas are unknown until sent.
+    memcpy(shadow, buffer, WIDTH * pages);
+    memcpy(&shadow[WIDTH * pages], dirtyLo, pages);
+    memcpy(&shadow[WIDTH * pages + pages], dirtyHi, pages);
+  } else if(mode == SSD1306_DIFF_CHECKSUM) {
+    if(!(pageSum = (uint32_t *)malloc(pages * sizeof(uint32_t))))
+      return false;
+    sumValid = 0;
+    for(uint8_t page=0; page<pages; page++) {
+      if(dirtyLo[page] > dirtyHi[page]) { // Unchanged, matches display
+        pageSum[page] = pageChecksum(&buffer[page * WIDTH], WIDTH);
+        sumValid     |= (uint32_t)1 << page;
+      }
+    }
+  }
+  return true;
+}
+
+/*!
+    @brief  Get the number of changed buffer bytes that the current diff
+            mode found identical to display RAM and did not send.
+    @return Cumulative byte count since begin().
+*/
+uint32_t Adafruit_SSD1306::getSkippedBytes(void) {
+  return skipped;
+}
+
+// Narrow each page's dirty span using the shadow copy or checksums.
+// Checksums are updated here, as display() will send every page that
+// remains dirty; the shadow copy is updated by display() as it goes.
+// Columns whose display RAM is unknown are always kept.
+void Adafruit_SSD1306::diffDirty(void) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+  for(uint8_t page=0; page<pages; page++) {
+    if(dirtyLo[page] > dirtyHi[page]) continue;
+    uint8_t  x1 = dirtyLo[page], *pBuf = &buffer[page * WIDTH];
+    uint16_t n  = dirtyHi[page] - x1 + 1;
+    if(shadow) {
+      uint8_t  *pShadow   = &shadow[page * WIDTH],
+               *unknownLo = &shadow[WIDTH * pages],
+               *unknownHi = &unknownLo[pages];
+      uint8_t   lo        = 0xFF, hi = 0; // Span to keep, none yet
+      uint16_t  first     = firstDiff(&pBuf[x1], &pShadow[x1], n), kept;
+      if(first < n) {
+        lo = x1 + first;
+        hi = x1 + lastDiff(&pBuf[x1], &pShadow[x1], n) - 1;
+      }
+      if(unknownLo[page] <= unknownHi[page]) { // Keep these, then forget
+        lo              = min(lo, unknownLo[page]);
+        hi              = max(hi, unknownHi[page]);
+        unknownLo[page] = 0xFF;
+        unknownHi[page] = 0;
+      }
+      kept          = (lo <= hi) ? (hi - lo + 1) : 0;
+      skipped      += (kept < n) ? (n - kept) : 0;
+      dirtyLo[page] = lo;
+      dirtyHi[page] = hi;
+      continue;
+    } else {
+      uint32_t sum = pageChecksum(pBuf, WIDTH), bit = (uint32_t)1 << page;
+      if(!(sumValid & bit) || (pageSum[page] != sum)) {
+        pageSum[page] = sum;
+        sumValid     |= bit;
+        continue;
+      }
+    }
+    skipped      += n; // Page is identical to display RAM, mark clean
+    dirtyLo[page] = 0xFF;
+    dirtyHi[page] = 0;
+  }
+}
+
+// REFRESH DISPLAY ---------------------------------------------------------
+
+// Latch the buffer's changed spans as the next frame to send, and mark
+// them clean so drawing can continue toward the following frame. Runs of
+// consecutive changed pages are merged into windows here (as long as the
+// extra unchanged bytes cost less than opening a new window -- six
+// command bytes plus, on I2C, another transmission), and every page of
+// a window is given the window's column span. This way the front buffer
+// and shadow copy get every byte that will really be sent.
+void Adafruit_SSD1306::latchFrame(void) {
+  if(shadow || pageSum) diffDirty();
+
+  uint8_t pages = (HEIGHT + 7) / 8;
+  memset(xferLo, 0xFF, pages);
+  memset(xferHi, 0   , pages);
+  xferActive = false;
+  if(bandPages) return; // Page-strip mode sends from drawBands() instead
+  for(uint8_t page=0; page<pages; ) {
+    if(dirtyLo[page] > dirtyHi[page]) { // Skip unchanged pages
+      page++;
+      continue;
+    }
+    uint8_t  page2 = page, x1 = dirtyLo[page], x2 = dirtyHi[page];
+    uint16_t bytes = x2 - x1 + 1;
+    for(uint8_t next = page + 1;
+      (next < pages) && (dirtyLo[next] <= dirtyHi[next]); next++) {
+      uint8_t  nx1    = min(x1, dirtyLo[next]),
+               nx2    = max(x2, dirtyHi[next]);
+      uint16_t merged = (nx2 - nx1 + 1) * (next - page + 1),
+               split  = bytes + (dirtyHi[next] - dirtyLo[next] + 1) + 8;
+      if(merged > split) break;
+      x1    = nx1;
+      x2    = nx2;
+      bytes = merged;
+      page2++;
+    }
+    for(; page <= page2; page++) {
+      uint16_t offset = page * WIDTH + x1;
+      if(front)  memcpy(&front[offset] , &buffer[offset], x2 - x1 + 1);
+      if(shadow) memcpy(&shadow[offset], &buffer[offset], x2 - x1 + 1);
+      xferLo[page]  = x1;
+      xferHi[page]  = x2;
+      dirtyLo[page] = 0xFF; // Mark page clean
+      dirtyHi[page] = 0;
+    }
+    xferActive = true;
+  }
+  xferBuf  = front ? front : buffer;
+  xferPage = xferPage2 = 0;
+  xferRow  = 1; // No window open yet
+}
+
+// Find the next window of the frame being sent (consecutive pages with
+// the same latched column span) at or after xferPage. Returns false if
+// there are no more.
+boolean Adafruit_SSD1306::nextWindow(void) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+  while((xferPage < pages) && (xferLo[xferPage] > xferHi[xferPage]))
+    xferPage++;
+  if(xferPage >= pages) return false;
+  xferX1 = xferLo[xferPage];
+  xferX2 = xferHi[xferPage];
+  for(xferPage2 = xferPage; ((xferPage2 + 1) < pages) &&
+    (xferLo[xferPage2 + 1] == xferX1) && (xferHi[xferPage2 + 1] == xferX2);
+    xferPage2++);
+  xferRow = xferPage;
+  xferCol = xferX1;
+  return true;
+}
+
+// Send up to maxBytes of the current window over I2C or SPI, resuming
+// from the xferRow/xferCol cursor and first setting the window address
+// if this is its start. Returns the number of data bytes sent. Any
+// partial I2C chunk is ended on return, leaving the bus free for other
+// devices. Transaction must be started in calling function.
+uint16_t Adafruit_SSD1306::sendWindow(uint16_t maxBytes) {
+  if((xferRow == xferPage) && (xferCol == xferX1))
+    ssd1306_window(xferPage, xferPage2, xferX1, xferX2);
+
+  uint16_t sent     = 0;
+  uint16_t bytesOut = 1;
+#if defined(SSD1306_ENABLE_TRACE)
+  uint16_t left = (xferPage2 - xferRow) * (xferX2 - xferX1 + 1) +
+                  (xferX2 - xferCol + 1);
+  TRACE(SSD1306_TRACE_DATA_BEGIN, min(left, maxBytes));
+#endif
+  if(USE_WIRE) { // I2C
+    WIRE_BEGIN(0x40);
+  } else { // SPI
+    SSD1306_MODE_DATA
+  }
+  uint8_t span = xferX2 - xferX1 + 1;
+  while((xferRow <= xferPage2) && (sent < maxBytes)) {
+    const uint8_t *ptr   = &xferBuf[xferRow * WIDTH + xferCol];
+    uint16_t       count = xferX2 - xferCol + 1;
+    // A full-width window is contiguous in the buffer, so the rest of it
+    // can go as one block rather than page by page
+    if(span == WIDTH) count += (xferPage2 - xferRow) * WIDTH;
+    if(count > (maxBytes - sent)) count = maxBytes - sent;
+    sent += count;
+    uint16_t col = xferCol + count;
+    if(col > xferX2) { // End of page(s), on to the next
+      xferRow += (col - xferX1) / span;
+      xferCol  = xferX1 + (col - xferX1) % span;
+    } else {
+      xferCol  = col;
+    }
+    if(USE_WIRE) {
+      while(count--) {
+        if(bytesOut >= wireChunk) {
+          WIRE_END(bytesOut);
+          WIRE_BEGIN(0x40);
+          bytesOut = 1;
+        }
+        WIRE_WRITE(*ptr++);
+        bytesOut++;
+      }
+    } else {
+      SPIwriteBlock(ptr, count);
+    }
+  }
+  if(USE_WIRE) {
+    WIRE_END(bytesOut);
+  }
+  if(xferRow > xferPage2) xferPage = xferPage2 + 1;
+  STAT_ADD(dataBytes, sent);
+  STAT_ADD(bytes, sent);
+  TRACE(SSD1306_TRACE_DATA_END, sent);
+  return sent;
+}
+
+// Keep the async transport fed with the frame being sent: one write()
+// per window page, or per window if it spans the full display width
+// (data is then contiguous). Window commands go with the first write.
+void Adafruit_SSD1306::pumpTransport(void) {
+  while(!transport->busy()) {
+    if((xferRow > xferPage2) && !nextWindow()) { // All sent and complete
+      endFrame();
+      return;
+    }
+    uint8_t  cmdLen = 0, rows = 1;
+    uint16_t len    = xferX2 - xferX1 + 1;
+    if(xferRow == xferPage) {
+      xferCmd[0] = SSD1306_PAGEADDR;
+      xferCmd[1] = xferPage;
+      xferCmd[2] = xferPage2;
+      xferCmd[3] = SSD1306_COLUMNADDR;
+      xferCmd[4] = xferX1;
+      xferCmd[5] = xferX2;
+      cmdLen     = sizeof(xferCmd);
+    }
+    if(len == WIDTH) {
+      rows = xferPage2 - xferRow + 1;
+      len *= rows;
+    }
+    if(!transport->write(cmdLen ? xferCmd : NULL, cmdLen,
+      &xferBuf[xferRow * WIDTH + xferX1], len)) return; // Retry later
+    STAT_ADD(commandBytes, cmdLen);
+    STAT_ADD(dataBytes, len);
+    STAT_ADD(bytes, cmdLen + len);
+    xferRow += rows;
+    if(xferRow > xferPage2) xferPage = xferPage2 + 1;
+  }
+}
+
+// Called once the last byte of a frame has gone out.
+void Adafruit_SSD1306::endFrame(void) {
+  xferActive = false;
+  STAT_ADD(frames, 1);
+  if(doneCallback) (*doneCallback)(this);
+}
+
+/*!
+    @brief  Push data currently in RAM to SSD1306 display.
+    @return None (void).
+    @note   Drawing operations are not visible until this function is
+            called. Call after each graphics command, or after a whole set
+            of graphics commands, as best needed by one's own application.
+            Only the parts of the buffer changed since the prior call are
+            sent: each run of consecutive changed pages goes out as one
+            PAGEADDR/COLUMNADDR window spanning the changed columns.
+            See also setDiffMode(). If a frame started by displayAsync()
+            (or displayStep()) is still being sent, this finishes it
+            first. With a frame rate set (see setFrameRate()), this may
+            only request a frame, merged with other requests and sent
+            once the frame period is up.
+*/
+void Adafruit_SSD1306::display(void) {
+  if(framePeriod) { // Governed: request a frame, send if it's time
+    if(framePending) coalescedCalls++;
+    framePending = true;
+    flushDisplay();
+    return;
+  }
+  displayFrame();
+}
+
+// Send the buffer's changes now; display() without the governor.
+void Adafruit_SSD1306::displayFrame(void) {
+  STAT_TIMER;
+  while(isBusy());
+  latchFrame();
+  if(xferActive && transport) while(isBusy());
+  if(!xferActive) { // Nothing changed since last display(), or sent above
+    STAT_TIME(displayMicros);
+    return;
+  }
+
+  TRANSACTION_START
+#if defined(ESP8266)
+  // ESP8266 needs a periodic yield() call to avoid watchdog reset.
+  // With the limited size of SSD1306 displays, and the fast bitrate
+  // being used (1 MHz or more), I think one yield() immediately before
+  // a screen write and one immediately after should cover it.  But if
+  // not, if this becomes a problem, yields() might be added in the
+  // 32-byte transfer condition below.
+  yield();
+#endif
+  while(nextWindow()) sendWindow(0xFFFF);
+  TRANSACTION_END
+#if defined(ESP8266)
+  yield();
+#endif
+  endFrame();
+  STAT_TIME(displayMicros);
+}
+
+/*!
+    @brief  Start pushing data currently in RAM to SSD1306 display, without
+            waiting for the transfer to finish. With a transport set via
+            setTransport(), the transfer proceeds in the background. With
+            none, each isBusy() call sends the next small piece of it.
+    @return true if a new frame was started (or there was nothing to send),
+            false if the previous frame is still being sent -- try again
+            later.
+    @note   Unless setDoubleBuffer(true) is used, drawing before isBusy()
+            returns false may show up partly in the frame being sent.
+            Either way, changes made after this call go out in the next
+            frame. setDisplayCallback() may be used to get notified when
+            the frame has been sent.
+*/
+boolean Adafruit_SSD1306::displayAsync(void) {
+  if(isBusy()) return false;
+  latchFrame();
+  if(xferActive && transport) pumpTransport();
+  return true;
+}
+
+/*!
+    @brief  Push data currently in RAM to SSD1306 display a piece at a time,
+            for cooperative multitasking. Each call sends at most the given
+            number of bytes (or for at most the given time), then returns,
+            resuming where it left off on the next call. A new frame is
+            started when the previous one has completed.
+    @param  maxBytes
+            Maximum number of data bytes to send in this call, or 0 for no
+            limit other than maxMicros. Window commands aren't counted.
+    @param  maxMicros
+            If nonzero, stop once this many microseconds have elapsed. The
+            time is checked after every I2C chunk (or equal-size run of SPI
+            bytes), so it may be exceeded by up to one chunk.
+    @return true if the frame has been completely sent (or there was
+            nothing to send), false if more calls are needed.
+    @note   Avoid issuing other commands to the display between steps of a
+            frame, as some (e.g. addressing mode) would disrupt it. With a
+            transport set, this simply starts a frame or checks isBusy().
+*/
+boolean Adafruit_SSD1306::displayStep(uint16_t maxBytes, uint32_t maxMicros) {
+  if(!xferActive) {
+    latchFrame();
+    if(!xferActive) return true; // Nothing changed
+  }
+  if(transport) return !isBusy();
+
+  if(!maxBytes) maxBytes = 0xFFFF;
+  uint16_t slice = maxMicros ? (wireChunk - 1) : maxBytes;
+  uint32_t t0    = micros();
+  TRANSACTION_START
+  while(maxBytes && ((xferRow <= xferPage2) || nextWindow())) {
+    maxBytes -= sendWindow(min(slice, maxBytes));
+    if(maxMicros && ((micros() - t0) >= maxMicros)) break;
+  }
+  TRANSACTION_END
+  if((xferRow > xferPage2) && !nextWindow()) endFrame();
+#if defined(SSD1306_ENABLE_STATS)
+  stats.displayMicros += micros() - t0;
+#endif
+  return !xferActive;
+}
+
+/*!
+    @brief  Check whether a frame started with displayAsync() is still being
+            sent. This also moves the transfer along -- handing the
+            transport its next piece of the frame, or without a transport,
+            sending one I2C chunk's worth of bytes itself -- so call it
+            regularly (e.g. once per pass through loop()).
+    @return true if busy, false if idle.
+*/
+boolean Adafruit_SSD1306::isBusy(void) {
+  if(xferActive) {
+    if(transport) pumpTransport();
+    else          displayStep(wireChunk - 1);
+  }
+  return xferActive;
+}
+
+/*!
+    @brief  Set an asynchronous transport for frame transfers, used by
+            displayAsync() and display() in place of the Wire or SPI
+            interface given to the constructor. Commands for initialization,
+            scrolling and such still go over the constructor's interface.
+    @param  t
+            Pointer to transport, or NULL to go back to blocking transfers.
+    @return None (void).
+*/
+void Adafruit_SSD1306::setTransport(Adafruit_SSD1306_Transport *t) {
+  if(buffer) while(isBusy());
+  transport = t;
+}
+
+/*!
+    @brief  Set a function to be called each time a frame (from display()
+            or displayAsync()) has been completely sent.
+    @param  cb
+            Callback function, receiving a pointer to this display, or NULL
+            for none. With a DMA transport this is invoked from isBusy().
+    @return None (void).
+*/
+void Adafruit_SSD1306::setDisplayCallback(SSD1306_Callback cb) {
+  doneCallback = cb;
+}
+
+/*!
+    @brief  Enable or disable double buffering. When enabled, a second,
+            equal-size buffer holds the frame being sent by displayAsync(),
+            so drawing of the next frame can proceed at once without
+            disturbing it.
+    @param  enable
+            true to allocate the second buffer, false to free it.
+    @return true on success, false if RAM could not be allocated.
+    @note   Call after begin().
+*/
+boolean Adafruit_SSD1306::setDoubleBuffer(boolean enable) {
+  if(buffer) while(isBusy());
+  if(enable) {
+    if(bandPages) return false;
+    if(!front) front = (uint8_t *)malloc(WIDTH * ((HEIGHT + 7) / 8));
+    return front != NULL;
+  }
+  free(front);
+  front = NULL;
+  return true;
+}
+
+/*!
+    @brief  Set the largest I2C transmission used for commands and frame
+            data, including the control byte. Each transmission costs a
+            START, address byte, control byte and STOP on the wire, so
+            fewer, longer ones make for faster frames. The default is the
+            Wire library's buffer size where it can be determined (32 bytes
+            on AVR, 128 on ESP32, 256 on RP2040, about that on SAMD). Going
+            to WIDTH+1 sends each page in a single transmission.
+    @param  bytes
+            Transmission size in bytes, limited to the range 2 to the Wire
+            buffer size. If the Wire buffer has been enlarged (e.g. by
+            editing the core), compile with SSD1306_WIRE_MAX defined to the
+            new size to lift the upper limit. To have frames or pages go out
+            in a single transfer regardless of Wire's buffer, see
+            setTransport().
+    @return Transmission size actually used.
+    @note   Has no effect on SPI displays.
+*/
+uint16_t Adafruit_SSD1306::setWireChunkSize(uint16_t bytes) {
+  if(buffer) while(isBusy());
+  wireChunk = constrain(bytes, 2, WIRE_MAX);
+  return wireChunk;
+}
+
+// FRAME-RATE GOVERNOR -----------------------------------------------------
+
+/*!
+    @brief  Limit display() to a frame rate, e.g. where several parts of a
+            sketch each call display() after drawing. display() then only
+            requests a frame, and the buffer's changes (from all requests
+            since the last frame) are sent at most once per frame period.
+    @param  rate
+            Most frames per second to send, or 0 (the default) for no
+            limit, display() sending at once.
+    @return None (void).
+    @note   A request made before the period is up is held until the next
+            display() or flushDisplay() call after it. Call flushDisplay()
+            regularly (e.g. from loop()) so the last of a burst of changes
+            isn't held indefinitely. displayAsync() and displayStep() are
+            not governed.
+*/
+void Adafruit_SSD1306::setFrameRate(uint16_t rate) {
+  if(framePending) flushDisplay(true);
+  framePeriod    = rate ? ((1000000UL + rate / 2) / rate) : 0;
+  coalescedCalls = 0;
+  fpsFrames      = 0;
+  fps            = 0;
+  frameLast      = fpsStart = micros();
+  frameLast     -= framePeriod; // First request goes at once
+}
+
+/*!
+    @brief  Send a frame requested by display() under setFrameRate(), if
+            the frame period is up or if forced.
+    @param  force
+            If true, send any requested frame now, regardless of the time
+            since the last one.
+    @return true if a frame was sent, false if none was requested or it's
+            not yet time.
+*/
+boolean Adafruit_SSD1306::flushDisplay(boolean force) {
+  if(!framePending) return false;
+  uint32_t now = micros();
+  if(!force && ((now - frameLast) < framePeriod)) return false;
+  framePending = false;
+  frameLast    = now;
+  displayFrame();
+
+  // Frame rate is measured over windows of a second or more
+  fpsFrames++;
+  uint32_t ms = (now - fpsStart) / 1000;
+  if(ms >= 1000) {
+    fps       = (uint32_t)fpsFrames * 1000 / ms;
+    fpsFrames = 0;
+    fpsStart  = now;
+  }
+  return true;
+}
+
+/*!
+    @brief  Get the rate at which display() frames are actually being sent
+            under setFrameRate().
+    @return Frames per second, as measured over the last second or so.
+*/
+uint16_t Adafruit_SSD1306::getFrameRate(void) {
+  uint32_t ms = (micros() - fpsStart) / 1000;
+  // No frames for a while, so the last measurement is out of date
+  if(ms >= 2000) return (uint32_t)fpsFrames * 1000 / ms;
+  return fps;
+}
+
+/*!
+    @brief  Get the number of display() calls under setFrameRate() that
+            were merged into a frame with another, rather than sending one
+            of their own.
+    @return Count since setFrameRate() was called.
+*/
+uint32_t Adafruit_SSD1306::getCoalescedCalls(void) {
+  return coalescedCalls;
+}
+
+// PAGE-STRIP RENDERING ----------------------------------------------------
+
+/*!
+    @brief  Select page-strip mode, for when RAM is too short for the full
+            buffer: only a band of a few pages is held, and the screen is
+            drawn a band at a time by drawBands().
+    @param  pages
+            Height of the band, in pages (8-pixel rows). RAM used is WIDTH
+            bytes per page, e.g. 128 bytes for one page of a 128-pixel
+            wide display. Taller bands mean fewer passes through the draw
+            function; 0 (or the full height) holds the whole screen as
+            usual.
+    @return true on success, false if the buffer is already in place
+            (begin() already called, or Adafruit_SSD1306_Static).
+    @note   Call before begin(). In this mode display(), displayAsync(),
+            setDiffMode() and setDoubleBuffer() need the full buffer and
+            have no effect, and drawing outside drawBands() only affects
+            the last band. begin()'s splash, if any, is sent rather than
+            drawn.
+*/
+boolean Adafruit_SSD1306::setBandHeight(uint8_t pages) {
+  if(buffer) return false;
+  bandPages = pages;
+  return true;
+}
+
+/*!
+    @brief  Draw and send the whole screen one band at a time: for each
+            band, the buffer is cleared, the draw function called and the
+            band sent as one PAGEADDR/COLUMNADDR window. Drawing is
+            clipped to the current band, so the draw function can simply
+            draw the whole screen each time.
+    @param  draw
+            Function drawing the screen, receiving a pointer to this
+            display. Called once per band.
+    @return None (void).
+    @note   Without setBandHeight(), this is the same as clearDisplay(),
+            draw(this) and display().
+*/
+void Adafruit_SSD1306::drawBands(SSD1306_Callback draw) {
+  if(!bandPages) {
+    clearDisplay();
+    (*draw)(this);
+    display();
+    return;
+  }
+
+  uint8_t pages = (HEIGHT + 7) / 8;
+  STAT_TIMER;
+  for(bandFirst = 0; bandFirst < pages; bandFirst += bandPages) {
+    bandLast = min(bandFirst + bandPages, (int)pages) - 1;
+    uint16_t n = (bandLast - bandFirst + 1) * WIDTH;
+    memset(buffer, 0, n);
+    (*draw)(this);
+
+    TRANSACTION_START
+    ssd1306_window(bandFirst, bandLast, 0, WIDTH - 1);
+    TRACE(SSD1306_TRACE_DATA_BEGIN, n);
+    if(USE_WIRE) { // I2C
+      const uint8_t *ptr      = buffer;
+      uint16_t       bytesOut = 1;
+      WIRE_BEGIN(0x40);
+      for(uint16_t i=0; i<n; i++) {
+        if(bytesOut >= wireChunk) {
+          WIRE_END(bytesOut);
+          WIRE_BEGIN(0x40);
+          bytesOut = 1;
+        }
+        WIRE_WRITE(*ptr++);
+        bytesOut++;
+      }
+      WIRE_END(bytesOut);
+    } else { // SPI
+      SSD1306_MODE_DATA
+      SPIwriteBlock(buffer, n);
+    }
+    TRACE(SSD1306_TRACE_DATA_END, n);
+    TRANSACTION_END
+    STAT_ADD(dataBytes, n);
+    STAT_ADD(bytes, n);
+  }
+  bandFirst -= bandPages; // Last band stays current
+  // Spans aren't used to send in this mode, keep them from accumulating
+  memset(dirtyLo, 0xFF, pages);
+  memset(dirtyHi, 0x00, pages);
+  STAT_ADD(frames, 1);
+  STAT_TIME(displayMicros);
+}
+
+// INSTRUMENTATION ---------------------------------------------------------
+
+#if defined(SSD1306_ENABLE_STATS)
+/*!
+    @brief  Get bus traffic and timing counters, accumulated since begin()
+            or the last resetStats() call. Only available if
+            SSD1306_ENABLE_STATS is defined in Adafruit_SSD1306.h (or as a
+            compiler flag).
+    @return Reference to SSD1306_Stats structure.
+*/
+const SSD1306_Stats &Adafruit_SSD1306::getStats(void) {
+  return stats;
+}
+
+/*!
+    @brief  Zero all bus traffic and timing counters.
+    @return None (void).
+*/
+void Adafruit_SSD1306::resetStats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
+#endif // SSD1306_ENABLE_STATS
+
+#if defined(SSD1306_ENABLE_TRACE)
+SSD1306_TraceHook Adafruit_SSD1306::traceHook = NULL;
+
+/*!
+    @brief  Set a function to be called at the start and end of each
+            command and data phase, and at the end of each I2C transmission,
+            e.g. to toggle a pin for a logic analyzer. Shared by all
+            displays; the hook receives a pointer to the one involved. Only
+            available if SSD1306_ENABLE_TRACE is defined in
+            Adafruit_SSD1306.h (or as a compiler flag).
+    @param  hook
+            Trace function, or NULL to disable.
+    @return None (void).
+    @note   The hook is called during bus transfers, keep it brief!
+*/
+void Adafruit_SSD1306::setTraceHook(SSD1306_TraceHook hook) {
+  traceHook = hook;
+}
+#endif // SSD1306_ENABLE_TRACE
+
+// SOFTWARE SCROLLING ------------------------------------------------------
+
+/*!
+    @brief  Shift the whole buffer contents, e.g. to scroll a log or
+            ticker by a line or a few pixels rather than redrawing it.
+            Unlike the hardware scrolling functions (startscrollright()
+            etc.), this moves the image in the buffer itself, so it stays
+            in step with what's shown and can be drawn over.
+    @param  dx
+            Pixels to move right (negative for left).
+    @param  dy
+            Pixels to move down (negative for up).
+    @param  color
+            Color for the area uncovered, SSD1306_BLACK or SSD1306_WHITE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application. Has no effect in
+            page-strip mode (see setBandHeight()).
+*/
+void Adafruit_SSD1306::scrollBuffer(int16_t dx, int16_t dy, uint16_t color) {
+  scrollRegion(0, 0, width(), height(), dx, dy, color);
+}
+
+/*!
+    @brief  Shift the contents of a rectangle of the buffer, leaving the
+            rest alone. Pixels moved out of the rectangle are lost.
+    @param  x
+            Leftmost column of the rectangle -- 0 at left to (screen width -
+            1) at right.
+    @param  y
+            Topmost row of the rectangle -- 0 at top to (screen height - 1)
+            at bottom.
+    @param  w
+            Width of rectangle, in pixels.
+    @param  h
+            Height of rectangle, in pixels.
+    @param  dx
+            Pixels to move right (negative for left).
+    @param  dy
+            Pixels to move down (negative for up).
+    @param  color
+            Color for the area uncovered, SSD1306_BLACK or SSD1306_WHITE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Has no effect in page-strip mode.
+*/
+void Adafruit_SSD1306::scrollRegion(int16_t x, int16_t y, int16_t w,
+  int16_t h, int16_t dx, int16_t dy, uint16_t color) {
+  if(bandPages) return;
+  if(x < 0) { // Clip to screen, in rotated coordinates
+    w += x;
+    x  = 0;
+  }
+  if(y < 0) {
+    h += y;
+    y  = 0;
+  }
+  if((x + w) > width())  w = width()  - x;
+  if((y + h) > height()) h = height() - y;
+  if((w <= 0) || (h <= 0)) return;
+
+  switch(rotation) {
+   case 1:
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    x = WIDTH - x - w;
+    ssd1306_swap(dx, dy);
+    dx = -dx;
+    break;
+   case 2:
+    x  = WIDTH  - x - w;
+    y  = HEIGHT - y - h;
+    dx = -dx;
+    dy = -dy;
+    break;
+   case 3:
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    y = HEIGHT - y - h;
+    ssd1306_swap(dx, dy);
+    dy = -dy;
+    break;
+  }
+  scrollRegionInternal(x, y, w, h, dx, dy, color == SSD1306_WHITE);
+}
+
+// Shift columns of a region vertically by dy rows. Each column of the
+// region's pages is gathered into one word, so moving it is a single
+// shift rather than carrying bits from page to page. rows has a bit set
+// for each row of the region, bit 0 being the top row of the first page.
+template <typename T>
+static void shiftColumns(uint8_t *ptr, uint8_t stride, uint8_t pages,
+  uint8_t w, T rows, int8_t dy, boolean fill) {
+  T dest    = rows & ((dy > 0) ? (rows << dy) : (rows >> -dy)),
+    vacated = fill ? (rows & ~dest) : 0;
+  for(; w--; ptr++) {
+    T col = 0;
+    for(uint8_t p=0; p<pages; p++)
+      col |= (T)ptr[p * stride] << (p * 8);
+    T moved = (dy > 0) ? (col << dy) : (col >> -dy);
+    col = (col & ~rows) | (moved & dest) | vacated;
+    for(uint8_t p=0; p<pages; p++) ptr[p * stride] = col >> (p * 8);
+  }
+}
+
+// Shift a region given in unrotated, already-clipped coordinates. The
+// horizontal part moves each page's bytes along (memmove() where all of
+// the page's rows are in the region), the vertical part moves whole
+// pages if dy is a multiple of 8 and the region is page-aligned, else
+// works a column at a time as above.
+void Adafruit_SSD1306::scrollRegionInternal(uint8_t x, uint8_t y, uint8_t w,
+  uint8_t h, int16_t dx, int16_t dy, boolean fill) {
+  if((dx >= w) || (-dx >= w) || (dy >= h) || (-dy >= h)) { // All uncovered
+    fillRectInternal(x, y, w, h, fill ? SSD1306_WHITE : SSD1306_BLACK);
+    return;
+  }
+
+  uint8_t page1 = y / 8, page2 = (y + h - 1) / 8, pages = page2 - page1 + 1;
+  uint8_t fillByte = fill ? 0xFF : 0x00;
+
+  if(dx) {
+    uint8_t n   = w - abs(dx),               // Columns kept
+            src = (dx > 0) ? x : (x - dx),   // First of them, now
+            dst = (dx > 0) ? (x + dx) : x,   // and after the move
+            gap = (dx > 0) ? x : (x + n);    // First column uncovered
+    for(uint8_t page=page1; page<=page2; page++) {
+      uint8_t *row  = &buffer[page * WIDTH];
+      uint8_t  mask = 0xFF;
+      if(page == page1) mask &= 0xFF << (y & 7);
+      if(page == page2) mask &= 0xFF >> (7 - ((y + h - 1) & 7));
+      if(mask == 0xFF) {
+        memmove(&row[dst], &row[src], n);
+        memset(&row[gap], fillByte, w - n);
+      } else {
+        uint8_t keep = ~mask, f = fillByte & mask;
+        if(dx > 0) { // Work from the far end so sources are read first
+          for(uint8_t i=n; i--; )
+            row[dst + i] = (row[dst + i] & keep) | (row[src + i] & mask);
+        } else {
+          for(uint8_t i=0; i<n; i++)
+            row[dst + i] = (row[dst + i] & keep) | (row[src + i] & mask);
+        }
+        for(uint8_t i=0; i<(w - n); i++)
+          row[gap + i] = (row[gap + i] & keep) | f;
+      }
+    }
+  }
+
+  if(dy) {
+    uint8_t *ptr = &buffer[page1 * WIDTH + x];
+    if(!((y | h | dy) & 7)) { // Page-aligned, move whole pages
+      int8_t  dp = dy / 8;
+      uint8_t n  = pages - abs(dp);
+      if(dp > 0) {
+        for(uint8_t i=n; i--; )
+          memcpy(&ptr[(i + dp) * WIDTH], &ptr[i * WIDTH], w);
+        for(uint8_t i=0; i<dp; i++) memset(&ptr[i * WIDTH], fillByte, w);
+      } else {
+        for(uint8_t i=0; i<n; i++)
+          memcpy(&ptr[i * WIDTH], &ptr[(i - dp) * WIDTH], w);
+        for(uint8_t i=n; i<pages; i++) memset(&ptr[i * WIDTH], fillByte, w);
+      }
+    } else if(pages <= 4) { // 32 bits suffice, cheaper on small MCUs
+      uint32_t rows = (0xFFFFFFFFUL >> (32 - h)) << (y & 7);
+      shiftColumns<uint32_t>(ptr, WIDTH, pages, w, rows, dy, fill);
+    } else {
+      uint64_t rows = (~(uint64_t)0 >> (64 - h)) << (y & 7);
+      shiftColumns<uint64_t>(ptr, WIDTH, pages, w, rows, dy, fill);
+    }
+  }
+
+  for(uint8_t page=page1; page<=page2; page++)
+    dirtySpan(page, x, x + w - 1);
+}
+
+// SCROLLING FUNCTIONS -----------------------------------------------------
+
+/*!
+    @brief  Activate a right-handed scroll for all or part of the display.
+    @param  start
+            First row.
+    @param  stop
+            Last row.
+    @return None (void).
+*/
+// To scroll the whole display, run: display.startscrollright(0x00, 0x0F)
+void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) {
+  TRANSACTION_START
+  static const uint8_t PROGMEM scrollList1a[] = {
+    SSD1306_RIGHT_HORIZONTAL_SCROLL,
+    0X00 };
+  ssd1306_commandList(scrollList1a, sizeof(scrollList1a));
+  ssd1306_command1(start);
+  ssd1306_command1(0X00);
+  ssd1306_command1(stop);
+  static const uint8_t PROGMEM scrollList1b[] = {
+    0X00,
+    0XFF,
+    SSD1306_ACTIVATE_SCROLL };
+  ssd1306_commandList(scrollList1b, sizeof(scrollList1b));
+  TRANSACTION_END
+}
+
+/*!
+    @brief  Activate a left-handed scroll for all or part of the display.
+    @param  start
+            First row.
+    @param  stop
+            Last row.
+    @return None (void).
+*/
+// To scroll the whole display, run: display.startscrollleft(0x00, 0x0F)
+void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop) {
+  TRANSACTION_START
+  static const uint8_t PROGMEM scrollList2a[] = {
+    SSD1306_LEFT_HORIZONTAL_SCROLL,
+    0X00 };
+  ssd1306_commandList(scrollList2a, sizeof(scrollList2a));
+  ssd1306_command1(start);
+  ssd1306_command1(0X00);
+  ssd1306_command1(stop);
+  static const uint8_t PROGMEM scrollList2b[] = {
+    0X00,
+    0XFF,
+    SSD1306_ACTIVATE_SCROLL };
+  ssd1306_commandList(scrollList2b, sizeof(scrollList2b));
+  TRANSACTION_END
+}
+
+/*!
+    @brief  Activate a diagonal scroll for all or part of the display.
+    @param  start
+            First row.
+    @param  stop
+            Last row.
+    @return None (void).
+*/
+// display.startscrolldiagright(0x00, 0x0F)
+void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop) {
+  TRANSACTION_START
+  static const uint8_t PROGMEM scrollList3a[] = {
+    SSD1306_SET_VERTICAL_SCROLL_AREA,
+    0X00 };
+  ssd1306_commandList(scrollList3a, sizeof(scrollList3a));
+  ssd1306_command1(HEIGHT);
+  static const uint8_t PROGMEM scrollList3b[] = {
+    SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL,
+    0X00 };
+  ssd1306_commandList(scrollList3b, sizeof(scrollList3b));
+  ssd1306_command1(start);
+  ssd1306_command1(0X00);
+  ssd1306_command1(stop);
+  static const uint8_t PROGMEM scrollList3c[] = {
+    0X01,
+    SSD1306_ACTIVATE_SCROLL };
+  ssd1306_commandList(scrollList3c, sizeof(scrollList3c));
+  TRANSACTION_END
+}
+
+/*!
+    @brief  Activate alternate diagonal scroll for all or part of the display.
+    @param  start
+            First row.
     @param  stop
             Last row.
     @return None (void).
@@ -1101,3 +2992,426 @@ void Adafruit_SSD1306::dim(boolean dim) {
   ssd1306_command1(contrast);
   TRANSACTION_END
 }
+
+// DISPLAY GROUPS ----------------------------------------------------------
+
+/*!
+    @brief  Constructor for a group of displays, initially empty.
+    @return Adafruit_SSD1306_Group object.
+*/
+Adafruit_SSD1306_Group::Adafruit_SSD1306_Group(void) : count(0) {
+  resetStats();
+}
+
+/*!
+    @brief  Add a display to the group.
+    @param  display
+            Pointer to display, on which begin() has been called.
+    @param  select
+            Function to call before each transfer to this display, e.g. to
+            switch an I2C multiplexer to its channel, or NULL if none is
+            needed. It receives a pointer to the display.
+    @return true on success, false if the group is full (see
+            SSD1306_GROUP_MAX).
+*/
+boolean Adafruit_SSD1306_Group::add(Adafruit_SSD1306 *display,
+  SSD1306_Callback select) {
+  if(count >= SSD1306_GROUP_MAX) return false;
+  displays[count] = display;
+  selects[count]  = select;
+  memset(&stats[count], 0, sizeof(stats[count]));
+  count++;
+  return true;
+}
+
+// Bus a display is on, to tell which share one. Each soft SPI display
+// counts as its own bus.
+const void *Adafruit_SSD1306_Group::bus(uint8_t index) {
+  Adafruit_SSD1306 *d = displays[index];
+  if(d->wire) return d->wire;
+  if(d->spi)  return d->spi;
+  return d;
+}
+
+void Adafruit_SSD1306_Group::select(uint8_t index) {
+  if(selects[index]) (*selects[index])(displays[index]);
+}
+
+/*!
+    @brief  Push each display's changes to it, as display() would, but
+            interleaved: every display with a frame to send gets a slice of
+            it in turn until all are done. Displays sharing an I2C bus
+            share one bus session, so the clock is set once for the lot.
+            Displays with a transport (see setTransport()) proceed in the
+            background alongside the others.
+    @param  slice
+            Data bytes sent to a display per turn, or 0 for one I2C
+            transmission's worth (see setWireChunkSize()). Smaller slices
+            interleave more finely.
+    @return None (void).
+    @note   Displays on one I2C bus run at the clock rate of the first one
+            added.
+*/
+void Adafruit_SSD1306_Group::display(uint16_t slice) {
+  uint16_t pending = 0;
+  uint8_t  i, j;
+
+  // First display on each I2C bus opens the session, the rest join it
+  // without touching the bus
+  for(i=0; i<count; i++) {
+    if(!displays[i]->wire) continue;
+    for(j=0; (j<i) && (bus(j) != bus(i)); j++);
+    if(j < i) displays[i]->busSession++;
+    else      displays[i]->beginBusSession();
+  }
+
+  // Latch each display's frame, noting its size
+  for(i=0; i<count; i++) {
+    Adafruit_SSD1306 *d = displays[i];
+    select(i);
+    while(d->isBusy()); // Finish any frame displayAsync() started
+    d->latchFrame();
+    if(!d->xferActive) continue; // Nothing changed
+    uint8_t pages = (d->HEIGHT + 7) / 8;
+    for(uint8_t page=0; page<pages; page++) {
+      if(d->xferLo[page] <= d->xferHi[page])
+        stats[i].bytes += d->xferHi[page] - d->xferLo[page] + 1;
+    }
+    if(d->transport) d->pumpTransport();
+    pending |= 1 << i;
+  }
+
+  // Send a slice of each in turn until all are done
+  while(pending) {
+    for(i=0; i<count; i++) {
+      if(!(pending & (1 << i))) continue;
+      Adafruit_SSD1306 *d = displays[i];
+      select(i);
+      uint32_t t0 = micros();
+      boolean  done = d->displayStep(slice ? slice : (d->wireChunk - 1));
+      stats[i].micros += micros() - t0;
+      if(done) {
+        stats[i].frames++;
+        pending &= ~(1 << i);
+      }
+    }
+  }
+
+  for(i=count; i--; ) {
+    if(!displays[i]->wire) continue;
+    for(j=0; (j<i) && (bus(j) != bus(i)); j++);
+    if(j < i) displays[i]->busSession--;
+    else      displays[i]->endBusSession();
+  }
+}
+
+/*!
+    @brief  Get transfer counters for one display of the group.
+    @param  index
+            Display's index in the group, in the order they were added.
+    @return SSD1306_GroupStats structure.
+*/
+const SSD1306_GroupStats &Adafruit_SSD1306_Group::getStats(uint8_t index) {
+  return stats[index];
+}
+
+/*!
+    @brief  Get transfer counters summed over all displays of the group
+            sharing one display's bus.
+    @param  index
+            Index of any display on the bus.
+    @return SSD1306_GroupStats structure.
+*/
+SSD1306_GroupStats Adafruit_SSD1306_Group::getBusStats(uint8_t index) {
+  SSD1306_GroupStats total = { 0, 0, 0 };
+  for(uint8_t i=0; i<count; i++) {
+    if(bus(i) != bus(index)) continue;
+    total.frames += stats[i].frames;
+    total.bytes  += stats[i].bytes;
+    total.micros += stats[i].micros;
+  }
+  return total;
+}
+
+/*!
+    @brief  Get transfer counters summed over the whole group.
+    @return SSD1306_GroupStats structure.
+*/
+SSD1306_GroupStats Adafruit_SSD1306_Group::getTotalStats(void) {
+  SSD1306_GroupStats total = { 0, 0, 0 };
+  for(uint8_t i=0; i<count; i++) {
+    total.frames += stats[i].frames;
+    total.bytes  += stats[i].bytes;
+    total.micros += stats[i].micros;
+  }
+  return total;
+}
+
+/*!
+    @brief  Get how busy one display's bus has been: the share of time
+            since resetStats() spent sending to the displays on it. Near
+            100 means the bus is saturated, and frames can't be sent any
+            faster than they are.
+    @param  index
+            Index of any display on the bus.
+    @return Percentage, 0 to 100.
+    @note   Time for displays with a transport counts only the calls
+            starting and checking their transfers, not the transfers.
+*/
+uint8_t Adafruit_SSD1306_Group::getBusLoad(uint8_t index) {
+  uint32_t elapsed = (micros() - statsStart) / 100; // In 1% units
+  if(!elapsed) return 0;
+  uint32_t busy = getBusStats(index).micros / elapsed;
+  return (busy > 100) ? 100 : busy;
+}
+
+/*!
+    @brief  Zero the transfer counters of all displays in the group.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Group::resetStats(void) {
+  memset(stats, 0, sizeof(stats));
+  statsStart = micros();
+}
+
+// TILED CANVAS ------------------------------------------------------------
+
+/*!
+    @brief  Constructor for a canvas made of several displays. Tiles are
+            added with addTile().
+    @param  w
+            Canvas width in pixels, including any gaps between tiles.
+    @param  h
+            Canvas height in pixels, including any gaps between tiles.
+    @return Adafruit_SSD1306_Tiled object.
+*/
+Adafruit_SSD1306_Tiled::Adafruit_SSD1306_Tiled(int16_t w, int16_t h) :
+  Adafruit_GFX(w, h), count(0) {
+}
+
+/*!
+    @brief  Add a display to the canvas.
+    @param  display
+            Pointer to display, on which begin() has been called.
+    @param  x
+            Canvas column of the tile's top left pixel.
+    @param  y
+            Canvas row of the tile's top left pixel. To compensate for
+            the bezels between panels, leave a gap between tiles as wide
+            as the bezels in pixels. What's drawn there isn't shown, so
+            shapes line up across panels as if seen through a window.
+    @param  rotation
+            Rotation of this panel (0-3, see setRotation()), e.g. for
+            panels mounted upside down. The tile's size on the canvas is
+            the display's width and height after rotation.
+    @param  select
+            Function to call before each transfer to this display, e.g. to
+            switch an I2C multiplexer to its channel, or NULL if none.
+    @return true on success, false if there's no room for more tiles (see
+            SSD1306_GROUP_MAX).
+*/
+boolean Adafruit_SSD1306_Tiled::addTile(Adafruit_SSD1306 *display,
+  int16_t x, int16_t y, uint8_t rotation, SSD1306_Callback select) {
+  if(!group.add(display, select)) return false;
+  display->setRotation(rotation);
+  tiles[count] = display;
+  tileX[count] = x;
+  tileY[count] = y;
+  count++;
+  return true;
+}
+
+/*!
+    @brief  Push changes to all the tiles' displays. Only tiles drawn to
+            since the last call are sent, and of those only the changed
+            spans, with displays sharing an I2C bus in one bus session.
+            Tiles with an async transport (see setTransport()) are sent
+            concurrently with the others; on Linux, that is the i2c-dev
+            and spidev transports begun with a thread, one per bus.
+    @param  slice
+            Data bytes sent to a display per turn, see
+            Adafruit_SSD1306_Group::display().
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::display(uint16_t slice) {
+  group.display(slice);
+}
+
+/*!
+    @brief  Get the group used to update the tiles, e.g. for its transfer
+            counters.
+    @return Reference to Adafruit_SSD1306_Group, tiles in the order added.
+*/
+Adafruit_SSD1306_Group &Adafruit_SSD1306_Tiled::getGroup(void) {
+  return group;
+}
+
+/*!
+    @brief  Set/clear/invert a single pixel.
+    @param  x
+            Column of canvas.
+    @param  y
+            Row of canvas.
+    @param  color
+            Pixel color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::drawPixel(int16_t x, int16_t y,
+  uint16_t color) {
+  if((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  switch(getRotation()) {
+   case 1:
+    ssd1306_swap(x, y);
+    x = WIDTH - x - 1;
+    break;
+   case 2:
+    x = WIDTH  - x - 1;
+    y = HEIGHT - y - 1;
+    break;
+   case 3:
+    ssd1306_swap(x, y);
+    y = HEIGHT - y - 1;
+    break;
+  }
+  for(uint8_t i=0; i<count; i++) {
+    int16_t tx = x - tileX[i], ty = y - tileY[i];
+    if((tx >= 0) && (tx < tiles[i]->width()) &&
+       (ty >= 0) && (ty < tiles[i]->height())) {
+      tiles[i]->drawPixel(tx, ty, color);
+      return; // Tiles don't overlap
+    }
+  }
+}
+
+/*!
+    @brief  Draw a horizontal line.
+    @param  x
+            Leftmost column of canvas.
+    @param  y
+            Row of canvas.
+    @param  w
+            Width of line, in pixels.
+    @param  color
+            Line color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::drawFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+/*!
+    @brief  Draw a vertical line.
+    @param  x
+            Column of canvas.
+    @param  y
+            Topmost row of canvas.
+    @param  h
+            Height of line, in pixels.
+    @param  color
+            Line color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::drawFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+/*!
+    @brief  Fill a rectangle.
+    @param  x
+            Leftmost column of canvas.
+    @param  y
+            Topmost row of canvas.
+    @param  w
+            Width of rectangle, in pixels.
+    @param  h
+            Height of rectangle, in pixels.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::fillRect(int16_t x, int16_t y, int16_t w,
+  int16_t h, uint16_t color) {
+  if((w <= 0) || (h <= 0)) return; // Nothing to fill, as in Adafruit_GFX
+  switch(rotation) {
+   case 1:
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    x = WIDTH - x - w;
+    break;
+   case 2:
+    x = WIDTH  - x - w;
+    y = HEIGHT - y - h;
+    break;
+   case 3:
+    ssd1306_swap(x, y);
+    ssd1306_swap(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+  fillRectInternal(x, y, w, h, color);
+}
+
+/*!
+    @brief  Fill a rectangle, as used by the Adafruit_GFX library within
+            startWrite()/endWrite() pairs. Same as fillRect().
+    @param  x
+            Leftmost column of canvas.
+    @param  y
+            Topmost row of canvas.
+    @param  w
+            Width of rectangle, in pixels.
+    @param  h
+            Height of rectangle, in pixels.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::writeFillRect(int16_t x, int16_t y, int16_t w,
+  int16_t h, uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+/*!
+    @brief  Fill the whole canvas (all tiles) with one color.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::fillScreen(uint16_t color) {
+  for(uint8_t i=0; i<count; i++) tiles[i]->fillScreen(color);
+}
+
+/*!
+    @brief  Enable or disable display invert mode on all tiles.
+    @param  i
+            If true, switch to invert mode (black-on-white), else normal
+            mode (white-on-black).
+    @return None (void).
+*/
+void Adafruit_SSD1306_Tiled::invertDisplay(boolean i) {
+  for(uint8_t n=0; n<count; n++) tiles[n]->invertDisplay(i);
+}
+
+// Fill a rectangle given in unrotated canvas coordinates: clip it to each
+// tile once, and pass the tile its part in its own coordinates.
+void Adafruit_SSD1306_Tiled::fillRectInternal(int16_t x, int16_t y,
+  int16_t w, int16_t h, uint16_t color) {
+  for(uint8_t i=0; i<count; i++) {
+    int16_t x1 = max(x, tileX[i]),
+            y1 = max(y, tileY[i]),
+            x2 = min(x + w, tileX[i] + tiles[i]->width()),
+            y2 = min(y + h, tileY[i] + tiles[i]->height());
+    if((x1 < x2) && (y1 < y2)) {
+      tiles[i]->fillRect(x1 - tileX[i], y1 - tileY[i], x2 - x1, y2 - y1,
+        color);
+    }
+  }
+}
@@ -32,6 +32,22 @@
 // (NEW CODE SHOULD IGNORE THIS, USE THE CONSTRUCTORS THAT ACCEPT WIDTH
 // AND HEIGHT ARGUMENTS).
 
+// Optional instrumentation, off by default as it costs some RAM and speed.
+// Uncomment (or pass as compiler flags) to enable:
+//#define SSD1306_ENABLE_STATS ///< Count bus traffic & time, see getStats()
+//#define SSD1306_ENABLE_TRACE ///< Call hook at bus phases, see setTraceHook()
+
+// Transports a project doesn't use can be compiled out, saving flash and
+// removing the per-call checks for them from the transfer loops. Their
+// constructors are then unavailable. Uncomment (or pass as flags):
+//#define SSD1306_NO_I2C     ///< Exclude I2C (Wire) support
+//#define SSD1306_NO_HWSPI   ///< Exclude hardware SPI support
+//#define SSD1306_NO_SOFTSPI ///< Exclude software (bitbang) SPI support
+
+// The Adafruit splash shown by begin() can also be compiled out,
+// saving its flash. Uncomment (or pass as a compiler flag):
+//#define SSD1306_NO_SPLASH ///< Exclude splash image, see begin()
+
 #if defined(ARDUINO_STM32_FEATHER)
   typedef class HardwareSPI SPIClass;
 #endif
@@ -95,6 +111,30 @@
 #define SSD1306_EXTERNALVCC         0x01 ///< External display voltage source
 #define SSD1306_SWITCHCAPVCC        0x02 ///< Gen. display voltage from 3.3V
 
+#define SSD1306_DIFF_NONE           0 ///< Send changed spans as drawn
+#define SSD1306_DIFF_SHADOW         1 ///< Compare w/copy of last frame sent
+#define SSD1306_DIFF_CHECKSUM       2 ///< Compare w/per-page checksums
+
+#define SSD1306_TRACE_COMMAND_BEGIN 0 ///< Command bytes about to be sent
+#define SSD1306_TRACE_COMMAND_END   1 ///< Command bytes sent
+#define SSD1306_TRACE_DATA_BEGIN    2 ///< Display data about to be sent
+#define SSD1306_TRACE_DATA_END      3 ///< Display data sent
+#define SSD1306_TRACE_CHUNK         4 ///< I2C transmission ended
+
+#define SSD1306_ROP_COPY            0 ///< Set & clear pixels to match bitmap
+#define SSD1306_ROP_OR              1 ///< Set pixels where bitmap is set
+#define SSD1306_ROP_AND             2 ///< Clear pixels where bitmap is clear
+#define SSD1306_ROP_XOR             3 ///< Invert pixels where bitmap is set
+#define SSD1306_ROP_CLEAR           4 ///< Clear pixels where bitmap is set
+
+#define SSD1306_SPLASH_DRAW         0 ///< begin() draws splash into buffer
+#define SSD1306_SPLASH_NONE         1 ///< begin() leaves buffer clear
+#define SSD1306_SPLASH_SEND         2 ///< begin() streams splash to display
+
+#if !defined(SSD1306_GROUP_MAX)
+ #define SSD1306_GROUP_MAX          4 ///< Displays per Adafruit_SSD1306_Group
+#endif
+
 #define SSD1306_RIGHT_HORIZONTAL_SCROLL              0x26 ///< Init rt scroll
 #define SSD1306_LEFT_HORIZONTAL_SCROLL               0x27 ///< Init left scroll
 #define SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL 0x29 ///< Init diag scroll
@@ -117,6 +157,92 @@
  #define SSD1306_LCDHEIGHT  16 ///< DEPRECATED: height w/SSD1306_96_16 defined
 #endif
 
+class Adafruit_SSD1306;
+
+/*!
+    @brief  Interface for an asynchronous (e.g. DMA-driven) link to an
+            SSD1306 display, see Adafruit_SSD1306::setTransport(). Derive
+            from this to hook up a platform-specific peripheral driver.
+*/
+class Adafruit_SSD1306_Transport {
+ public:
+  virtual ~Adafruit_SSD1306_Transport(void) {}
+  /*!
+      @brief  Start sending bytes to the display and return immediately,
+              without waiting for the transfer to finish.
+      @param  cmd
+              Command bytes to send first (I2C control byte 0x00, or SPI
+              with D/C low). cmdLen may be 0, in which case this is NULL.
+      @param  cmdLen
+              Number of command bytes.
+      @param  data
+              Data bytes to send next (I2C control byte 0x40, or SPI with
+              D/C high).
+      @param  len
+              Number of data bytes.
+      @return true if the transfer was started, false if it could not be
+              (it will be retried later).
+      @note   Both arrays remain valid and unmodified until busy() returns
+              false.
+  */
+  virtual boolean write(const uint8_t *cmd, uint8_t cmdLen,
+                        const uint8_t *data, uint16_t len) = 0;
+  /*!
+      @brief  Check whether a transfer started by write() is in progress.
+      @return true if busy, false if the transport can accept a write().
+  */
+  virtual boolean busy(void) = 0;
+};
+
+/// Function called when a frame finishes transmitting, see
+/// Adafruit_SSD1306::setDisplayCallback().
+typedef void (*SSD1306_Callback)(Adafruit_SSD1306 *display);
+
+/// Function called at bus phase boundaries (SSD1306_TRACE_* event) with
+/// the number of bytes involved, see Adafruit_SSD1306::setTraceHook().
+typedef void (*SSD1306_TraceHook)(Adafruit_SSD1306 *display, uint8_t event,
+                                  uint16_t count);
+
+/*!
+    @brief  Bus traffic and timing counters, see Adafruit_SSD1306::getStats().
+            Only maintained if SSD1306_ENABLE_STATS is defined.
+*/
+typedef struct {
+  uint32_t bytes;            ///< All bytes sent, incl. I2C control bytes
+  uint32_t commandBytes;     ///< Command bytes sent
+  uint32_t dataBytes;        ///< Display data bytes sent
+  uint32_t i2cTransmissions; ///< I2C begin/endTransmission() pairs
+  uint32_t spiTransactions;  ///< SPI transactions (chip select periods)
+  uint32_t clockChanges;     ///< Wire setClock() calls
+  uint32_t frames;           ///< Frames completely sent
+  uint32_t displayMicros;    ///< Time spent in display() & displayStep()
+  uint32_t commandMicros;    ///< Time spent sending commands (incl. the
+                             ///< window setup within display())
+} SSD1306_Stats;
+
+/*!
+    @brief  Playback position in an animation made by scripts/make_anim.py,
+            see Adafruit_SSD1306::startAnimation().
+*/
+typedef struct {
+  const uint8_t *first;  ///< First frame's delta in PROGMEM
+  const uint8_t *next;   ///< Next frame's delta in PROGMEM
+  uint16_t       frame;  ///< Index of the frame in the buffer
+  uint16_t       frames; ///< Number of frames
+  int16_t        x;      ///< Leftmost column, unrotated
+  int16_t        page;   ///< Topmost page, unrotated
+} SSD1306_Animation;
+
+/*!
+    @brief  Per-display transfer counters, see
+            Adafruit_SSD1306_Group::getStats().
+*/
+typedef struct {
+  uint32_t frames; ///< Frames sent
+  uint32_t bytes;  ///< Display data bytes sent
+  uint32_t micros; ///< Time spent sending
+} SSD1306_GroupStats;
+
 /*! 
     @brief  Class that stores state and functions for interacting with
             SSD1306 OLED displays.
@@ -124,24 +250,37 @@
 class Adafruit_SSD1306 : public Adafruit_GFX {
  public:
   // NEW CONSTRUCTORS -- recommended for new projects
+#if !defined(SSD1306_NO_I2C)
   Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi=&Wire, int8_t rst_pin=-1,
     uint32_t clkDuring=400000UL, uint32_t clkAfter=100000UL);
+#endif
+#if !defined(SSD1306_NO_SOFTSPI)
   Adafruit_SSD1306(uint8_t w, uint8_t h, int8_t mosi_pin, int8_t sclk_pin,
     int8_t dc_pin, int8_t rst_pin, int8_t cs_pin);
+#endif
+#if !defined(SSD1306_NO_HWSPI)
   Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass *spi,
     int8_t dc_pin, int8_t rst_pin, int8_t cs_pin, uint32_t bitrate=8000000UL);
+#endif
 
   // DEPRECATED CONSTRUCTORS - for back compatibility, avoid in new projects
+#if !defined(SSD1306_NO_SOFTSPI)
   Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin, int8_t dc_pin,
     int8_t rst_pin, int8_t cs_pin);
+#endif
+#if !defined(SSD1306_NO_HWSPI)
   Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin, int8_t cs_pin);
+#endif
+#if !defined(SSD1306_NO_I2C)
   Adafruit_SSD1306(int8_t rst_pin = -1);
+#endif
 
   ~Adafruit_SSD1306(void);
 
   boolean      begin(uint8_t switchvcc=SSD1306_SWITCHCAPVCC,
                  uint8_t i2caddr=0, boolean reset=true,
-                 boolean periphBegin=true);
+                 boolean periphBegin=true,
+                 uint8_t splash=SSD1306_SPLASH_DRAW);
   void         display(void);
   void         clearDisplay(void);
   void         invertDisplay(boolean i);
@@ -149,27 +288,143 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
   void         drawPixel(int16_t x, int16_t y, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  void         blit(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                 int16_t h, uint8_t rop=SSD1306_ROP_OR);
+  void         blit(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                 int16_t h, uint8_t rop=SSD1306_ROP_OR);
+  void         blitMasked(int16_t x, int16_t y, const uint8_t bitmap[],
+                 const uint8_t mask[], int16_t w, int16_t h);
+  void         blitMasked(int16_t x, int16_t y, uint8_t *bitmap,
+                 uint8_t *mask, int16_t w, int16_t h);
+  void         drawPageImage(int16_t x, int16_t page, const uint8_t data[],
+                 uint8_t w, uint8_t pages, boolean rle=false);
+  void         sendPageImage(int16_t x, int16_t page, const uint8_t data[],
+                 uint8_t w, uint8_t pages, boolean rle=false);
+  void         startAnimation(SSD1306_Animation &anim, const uint8_t data[],
+                 int16_t x=0, int16_t page=0);
+  uint16_t     nextAnimationFrame(SSD1306_Animation &anim);
+  void         scrollBuffer(int16_t dx, int16_t dy,
+                 uint16_t color=SSD1306_BLACK);
+  void         scrollRegion(int16_t x, int16_t y, int16_t w, int16_t h,
+                 int16_t dx, int16_t dy, uint16_t color=SSD1306_BLACK);
   void         startscrollright(uint8_t start, uint8_t stop);
   void         startscrollleft(uint8_t start, uint8_t stop);
   void         startscrolldiagright(uint8_t start, uint8_t stop);
   void         startscrolldiagleft(uint8_t start, uint8_t stop);
   void         stopscroll(void);
   void         ssd1306_command(uint8_t c);
+  void         beginBusSession(void);
+  void         endBusSession(void);
   boolean      getPixel(int16_t x, int16_t y);
   uint8_t     *getBuffer(void);
+  const uint8_t *getBufferReadOnly(void);
+  boolean      setDiffMode(uint8_t mode);
+  uint32_t     getSkippedBytes(void);
+  boolean      displayAsync(void);
+  boolean      displayStep(uint16_t maxBytes, uint32_t maxMicros=0);
+  boolean      isBusy(void);
+  void         setTransport(Adafruit_SSD1306_Transport *t);
+  void         setDisplayCallback(SSD1306_Callback cb);
+  boolean      setDoubleBuffer(boolean enable);
+  uint16_t     setWireChunkSize(uint16_t bytes);
+  void         setFrameRate(uint16_t rate);
+  boolean      flushDisplay(boolean force=false);
+  uint16_t     getFrameRate(void);
+  uint32_t     getCoalescedCalls(void);
+  boolean      setBandHeight(uint8_t pages);
+  void         drawBands(SSD1306_Callback draw);
+#if defined(SSD1306_ENABLE_STATS)
+  const SSD1306_Stats &getStats(void);
+  void         resetStats(void);
+#endif
+#if defined(SSD1306_ENABLE_TRACE)
+  static void  setTraceHook(SSD1306_TraceHook hook);
+#endif
 
- private:
-  inline void  SPIwrite(uint8_t d) __attribute__((always_inline));
+ protected:
+  friend class Adafruit_SSD1306_Group;
+  friend class Adafruit_SSD1306_Pipeline;
+  void         softSPIwriteBlock(const uint8_t *ptr, uint16_t n);
+  void         SPIwriteBlock(const uint8_t *ptr, uint16_t n);
+  inline void  dirtySpan(uint8_t page, uint8_t x1, uint8_t x2)
+                 __attribute__((always_inline));
+  void         dirtyAll(void);
+  void         staleSpan(uint8_t page, uint8_t x1, uint8_t x2);
+  void         diffDirty(void);
+  void         latchFrame(void);
+  boolean      nextWindow(void);
+  uint16_t     sendWindow(uint16_t maxBytes);
+  void         pumpTransport(void);
+  void         endFrame(void);
+  void         displayFrame(void);
   void         drawFastHLineInternal(int16_t x, int16_t y, int16_t w,
                  uint16_t color);
   void         drawFastVLineInternal(int16_t x, int16_t y, int16_t h,
                  uint16_t color);
+  void         fillRectInternal(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                 uint16_t color);
+  void         blitInternal(int16_t x, int16_t y, const uint8_t *bitmap,
+                 const uint8_t *mask, int16_t w, int16_t h, uint8_t rop,
+                 boolean progmem);
+  const uint8_t *drawPageImageInternal(int16_t x, int16_t page,
+                 const uint8_t *data, uint8_t w, uint8_t pages, boolean rle);
+  void         sendPageImageInternal(int16_t x, int16_t page,
+                 const uint8_t *data, uint8_t w, uint8_t pages, boolean rle,
+                 boolean fill);
+  void         scrollRegionInternal(uint8_t x, uint8_t y, uint8_t w,
+                 uint8_t h, int16_t dx, int16_t dy, boolean fill);
+  void         wireCommand(uint8_t c);
+  void         wireFlush(void);
   void         ssd1306_command1(uint8_t c);
   void         ssd1306_commandList(const uint8_t *c, uint8_t n);
+  void         ssd1306_window(uint8_t page1, uint8_t page2, uint8_t col1,
+                 uint8_t col2);
 
   SPIClass    *spi;
   TwoWire     *wire;
   uint8_t     *buffer;
+  uint8_t     *dirtyLo;    // Per-page leftmost changed column
+  uint8_t     *dirtyHi;    // Per-page rightmost changed column
+  uint8_t     *shadow;     // Copy of display RAM, then per-page unknown
+                           // spans (lo[], hi[]) (SSD1306_DIFF_SHADOW)
+  uint32_t    *pageSum;    // Per-page checksums (SSD1306_DIFF_CHECKSUM)
+  uint8_t     *front;      // Frame being sent while buffer is redrawn
+  Adafruit_SSD1306_Transport *transport; // Async transport, or NULL
+  SSD1306_Callback doneCallback;         // Frame-sent callback, or NULL
+  uint16_t     wireChunk;  // Max bytes per I2C transmission, incl. control
+  uint16_t     cmdOut;     // Bytes in open I2C command transmission, or 0
+  uint8_t      busSession; // Nesting depth of transactions/bus sessions
+  uint8_t      bandPages;  // Pages per band in page-strip mode, else 0
+  uint8_t      bandFirst;  // First page held in buffer (0 unless strips)
+  uint8_t      bandLast;   // Last page held in buffer
+  uint32_t     framePeriod;    // Governor frame period in micros, or 0
+  uint32_t     frameLast;      // micros() when governor last sent a frame
+  uint32_t     fpsStart;       // micros() at start of frame rate window
+  uint32_t     coalescedCalls; // display() calls merged with another
+  uint16_t     fpsFrames;      // Frames sent in frame rate window
+  uint16_t     fps;            // Frame rate over last window
+  boolean      framePending;   // display() called, frame not yet sent
+  const uint8_t *xferBuf;  // Frame being sent (buffer, or front if set)
+  uint8_t     *xferLo;     // Per-page leftmost column of frame being sent
+  uint8_t     *xferHi;     // Per-page rightmost column of frame being sent
+  uint8_t      xferPage, xferPage2, xferX1, xferX2; // Current window
+  uint8_t      xferRow;    // Next page of current window to be sent
+  uint8_t      xferCol;    // Next column of xferRow to be sent
+  boolean      xferActive; // True while a frame is being sent
+  uint8_t      xferCmd[6]; // Window command bytes for transport->write()
+#if defined(SSD1306_ENABLE_STATS)
+  SSD1306_Stats stats;
+#endif
+#if defined(SSD1306_ENABLE_TRACE)
+  static SSD1306_TraceHook traceHook;
+#endif
+  uint32_t     sumValid;   // Bitmask of pages whose pageSum[] is valid
+  uint32_t     skipped;    // Changed bytes found identical by diffDirty()
   int8_t       i2caddr, vccstate, page_end;
   int8_t       mosiPin    ,  clkPin    ,  dcPin    ,  csPin, rstPin;
 #ifdef HAVE_PORTREG
@@ -185,4 +440,301 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
 #endif
 };
 
+// Expand the changed-column span of one buffer page to include columns
+// x1 through x2 (x1 <= x2, both already clipped to the display).
+// display() uses these spans to upload only what has changed. Defined
+// here so that subclasses' drawing functions can inline it.
+inline void Adafruit_SSD1306::dirtySpan(uint8_t page, uint8_t x1,
+  uint8_t x2) {
+  if(x1 < dirtyLo[page]) dirtyLo[page] = x1;
+  if(x2 > dirtyHi[page]) dirtyHi[page] = x2;
+}
+
+/*!
+    @brief  SSD1306 display whose size is fixed at compile time. The image
+            buffer is a member array rather than being allocated by begin(),
+            so RAM use shows up at link time, begin() can't fail for lack of
+            memory and there's no heap fragmentation. Clipping, rotation
+            and buffer addressing in drawPixel(), the line and rectangle
+            fills and fillScreen() use the constant dimensions, which lets
+            the compiler turn multiplies into shifts. Otherwise identical to
+            Adafruit_SSD1306, e.g.:
+            Adafruit_SSD1306_Static<128, 64> display(&Wire, -1);
+    @tparam W
+            Display width in pixels (up to 128)
+    @tparam H
+            Display height in pixels (up to 64)
+*/
+template <uint8_t W, uint8_t H>
+class Adafruit_SSD1306_Static : public Adafruit_SSD1306 {
+ public:
+  static const uint8_t  PAGES        = (H + 7) / 8; ///< Rows of 8 pixels
+  static const uint16_t BUFFER_BYTES = W * PAGES;   ///< Image buffer size
+
+#if !defined(SSD1306_NO_I2C)
+  /*!
+      @brief  Constructor for I2C-interfaced displays, see Adafruit_SSD1306.
+  */
+  Adafruit_SSD1306_Static(TwoWire *twi=&Wire, int8_t rst_pin=-1,
+    uint32_t clkDuring=400000UL, uint32_t clkAfter=100000UL) :
+    Adafruit_SSD1306(W, H, twi, rst_pin, clkDuring, clkAfter) {
+    buffer = mem;
+  }
+#endif
+#if !defined(SSD1306_NO_SOFTSPI)
+  /*!
+      @brief  Constructor for software (bitbang) SPI displays, see
+              Adafruit_SSD1306.
+  */
+  Adafruit_SSD1306_Static(int8_t mosi_pin, int8_t sclk_pin, int8_t dc_pin,
+    int8_t rst_pin, int8_t cs_pin) :
+    Adafruit_SSD1306(W, H, mosi_pin, sclk_pin, dc_pin, rst_pin, cs_pin) {
+    buffer = mem;
+  }
+#endif
+#if !defined(SSD1306_NO_HWSPI)
+  /*!
+      @brief  Constructor for hardware SPI displays, see Adafruit_SSD1306.
+  */
+  Adafruit_SSD1306_Static(SPIClass *spi, int8_t dc_pin, int8_t rst_pin,
+    int8_t cs_pin, uint32_t bitrate=8000000UL) :
+    Adafruit_SSD1306(W, H, spi, dc_pin, rst_pin, cs_pin, bitrate) {
+    buffer = mem;
+  }
+#endif
+
+  /*!
+      @brief  Destructor. The buffer is part of the object, so it's
+              detached here to keep ~Adafruit_SSD1306() from freeing it.
+  */
+  ~Adafruit_SSD1306_Static(void) {
+    buffer = NULL;
+  }
+
+  /*!
+      @brief  Set/clear/invert a single pixel, see Adafruit_SSD1306.
+      @param  x
+              Column of display -- 0 at left to (screen width - 1) at right.
+      @param  y
+              Row of display -- 0 at top to (screen height -1) at bottom.
+      @param  color
+              Pixel color, one of: SSD1306_BLACK, SSD1306_WHITE or
+              SSD1306_INVERSE.
+      @return None (void).
+  */
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
+      switch(getRotation()) {
+       case 1:
+        { int16_t t = x; x = W - y - 1; y = t; }
+        break;
+       case 2:
+        x = W - x - 1;
+        y = H - y - 1;
+        break;
+       case 3:
+        { int16_t t = x; x = y; y = H - t - 1; }
+        break;
+      }
+      uint8_t *ptr = &mem[(uint8_t)x + ((uint8_t)y >> 3) * W];
+      uint8_t  bit = 1 << (y & 7);
+      switch(color) {
+       case SSD1306_WHITE:   *ptr |=  bit; break;
+       case SSD1306_BLACK:   *ptr &= ~bit; break;
+       case SSD1306_INVERSE: *ptr ^=  bit; break;
+      }
+      dirtySpan((uint8_t)y >> 3, x, x);
+    }
+  }
+
+  /*!
+      @brief  Draw a horizontal line, see Adafruit_SSD1306.
+      @param  x
+              Leftmost column.
+      @param  y
+              Row of display.
+      @param  w
+              Width of line, in pixels.
+      @param  color
+              Line color, one of: SSD1306_BLACK, SSD1306_WHITE or
+              SSD1306_INVERSE.
+      @return None (void).
+  */
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+  }
+
+  /*!
+      @brief  Draw a vertical line, see Adafruit_SSD1306.
+      @param  x
+              Column of display.
+      @param  y
+              Topmost row.
+      @param  h
+              Height of line, in pixels.
+      @param  color
+              Line color, one of: SSD1306_BLACK, SSD1306_WHITE or
+              SSD1306_INVERSE.
+      @return None (void).
+  */
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+  }
+
+  /*!
+      @brief  Fill a rectangle, see Adafruit_SSD1306. Clipping, rotation
+              and buffer addressing use the constant W and H.
+      @param  x
+              Leftmost column.
+      @param  y
+              Topmost row.
+      @param  w
+              Width of rectangle, in pixels.
+      @param  h
+              Height of rectangle, in pixels.
+      @param  color
+              Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+              SSD1306_INVERSE.
+      @return None (void).
+  */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+    uint16_t color) {
+    if((w <= 0) || (h <= 0)) return;
+    uint8_t r = getRotation();
+    int16_t rw = (r & 1) ? H : W, rh = (r & 1) ? W : H;
+    if(x < 0) {
+      w += x;
+      x  = 0;
+    }
+    if(y < 0) {
+      h += y;
+      y  = 0;
+    }
+    if((x + w) > rw) w = rw - x;
+    if((y + h) > rh) h = rh - y;
+    if((w <= 0) || (h <= 0)) return;
+    switch(r) {
+     case 1:
+      { int16_t t = x; x = W - y - h; y = t; t = w; w = h; h = t; }
+      break;
+     case 2:
+      x = W - x - w;
+      y = H - y - h;
+      break;
+     case 3:
+      { int16_t t = y; y = H - x - w; x = t; t = w; w = h; h = t; }
+      break;
+    }
+    fill(x, y, w, h, color);
+  }
+
+  /*!
+      @brief  Fill the whole screen with one color, see Adafruit_SSD1306.
+      @param  color
+              Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or
+              SSD1306_INVERSE.
+      @return None (void).
+  */
+  void fillScreen(uint16_t color) {
+    if(color == SSD1306_BLACK) clearDisplay(); // Only marks lit columns
+    else                       fill(0, 0, W, H, color);
+  }
+
+ private:
+  static_assert((W > 0) && (W <= 128) && (H > 0) && (H <= 64),
+    "SSD1306 supports up to 128x64 pixels");
+  // Fill a rectangle given in unrotated, clipped coordinates, a page at
+  // a time as Adafruit_SSD1306::fillRectInternal() does. Page-strip mode
+  // can't be used (the buffer exists before setBandHeight() could be
+  // called), so the whole display is always in the buffer.
+  void fill(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color) {
+    uint8_t  page1 = y >> 3, page2 = (y + h - 1) >> 3;
+    uint8_t *pBuf  = &mem[page1 * W + x];
+    for(uint8_t page=page1; page<=page2; page++, pBuf += W) {
+      uint8_t mask = 0xFF, *ptr = pBuf, n = w;
+      if(page == page1) mask &= 0xFF << (y & 7);
+      if(page == page2) mask &= 0xFF >> (7 - ((y + h - 1) & 7));
+      dirtySpan(page, x, x + w - 1);
+      if((mask == 0xFF) && (color != SSD1306_INVERSE)) {
+        memset(ptr, (color == SSD1306_WHITE) ? 0xFF : 0x00, n);
+        continue;
+      }
+      switch(color) {
+       case SSD1306_WHITE:               while(n--) *ptr++ |= mask; break;
+       case SSD1306_BLACK: mask = ~mask; while(n--) *ptr++ &= mask; break;
+       case SSD1306_INVERSE:             while(n--) *ptr++ ^= mask; break;
+      }
+    }
+  }
+  // Image buffer, followed by the per-page dirty-span arrays as begin()
+  // would allocate them.
+  uint8_t mem[BUFFER_BYTES + 4 * PAGES] __attribute__((aligned(4)));
+};
+
+/*!
+    @brief  Set of displays updated together. Displays sharing an I2C bus
+            share one bus session per update, so the clock is changed once
+            for all of them, and frames are sent a slice at a time in
+            turn so no display waits for all the others to finish. Displays
+            behind an I2C multiplexer can each be given a function that
+            selects their channel.
+*/
+class Adafruit_SSD1306_Group {
+ public:
+  Adafruit_SSD1306_Group(void);
+
+  boolean  add(Adafruit_SSD1306 *display, SSD1306_Callback select=NULL);
+  void     display(uint16_t slice=0);
+  const SSD1306_GroupStats &getStats(uint8_t index);
+  SSD1306_GroupStats getBusStats(uint8_t index);
+  SSD1306_GroupStats getTotalStats(void);
+  uint8_t  getBusLoad(uint8_t index);
+  void     resetStats(void);
+
+ private:
+  static_assert(SSD1306_GROUP_MAX <= 16, "SSD1306_GROUP_MAX is 16 at most");
+  const void *bus(uint8_t index);
+  void     select(uint8_t index);
+  Adafruit_SSD1306   *displays[SSD1306_GROUP_MAX];
+  SSD1306_Callback    selects[SSD1306_GROUP_MAX]; // Mux select, or NULL
+  SSD1306_GroupStats  stats[SSD1306_GROUP_MAX];
+  uint8_t             count;      // Number of displays added
+  uint32_t            statsStart; // micros() at resetStats()
+};
+
+/*!
+    @brief  Canvas spanning several displays (tiles) as one large drawing
+            area, e.g. a 2x2 or 4x1 wall of panels. Graphics calls are
+            clipped to each tile they touch and passed to its own buffer,
+            and display() sends each tile's changes as an
+            Adafruit_SSD1306_Group does.
+*/
+class Adafruit_SSD1306_Tiled : public Adafruit_GFX {
+ public:
+  Adafruit_SSD1306_Tiled(int16_t w, int16_t h);
+
+  boolean      addTile(Adafruit_SSD1306 *display, int16_t x, int16_t y,
+                 uint8_t rotation=0, SSD1306_Callback select=NULL);
+  void         display(uint16_t slice=0);
+  void         drawPixel(int16_t x, int16_t y, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  virtual void invertDisplay(boolean i);
+  Adafruit_SSD1306_Group &getGroup(void);
+
+ private:
+  void         fillRectInternal(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  Adafruit_SSD1306_Group group;
+  Adafruit_SSD1306      *tiles[SSD1306_GROUP_MAX];
+  int16_t      tileX[SSD1306_GROUP_MAX]; // Tile's top left in canvas
+  int16_t      tileY[SSD1306_GROUP_MAX];
+  uint8_t      count; // Number of tiles added
+};
+
 #endif // _Adafruit_SSD1306_H_
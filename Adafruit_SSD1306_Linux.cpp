@@ -0,0 +1,624 @@
+/*!
+ * @file Adafruit_SSD1306_Linux.cpp
+ *
+ * Part of Adafruit's SSD1306 library. Linux userspace (i2c-dev and
+ * spidev) transports, see Adafruit_SSD1306_Linux.h.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+#include "Adafruit_SSD1306_Linux.h"
+
+// Pipeline queue indices and counters, and transport thread hand-offs, are
+// shared between threads without a lock
+#define PIPE_LOAD(v)     __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define PIPE_STORE(v, n) __atomic_store_n(&(v), (n), __ATOMIC_RELEASE)
+#define PIPE_CAS(v, o, n) \
+  __atomic_compare_exchange_n(&(v), &(o), (n), false, __ATOMIC_ACQ_REL, \
+    __ATOMIC_ACQUIRE)
+#define PIPE_ADD(v, n)   __atomic_fetch_add(&(v), (n), __ATOMIC_RELAXED)
+
+// SYSTEM I/O --------------------------------------------------------------
+
+Adafruit_SSD1306_LinuxIO Adafruit_SSD1306_LinuxIO::system;
+
+int Adafruit_SSD1306_LinuxIO::open(const char *path, int flags) {
+  return ::open(path, flags);
+}
+
+int Adafruit_SSD1306_LinuxIO::close(int fd) {
+  return ::close(fd);
+}
+
+int Adafruit_SSD1306_LinuxIO::ioctl(int fd, unsigned long request,
+  void *arg) {
+  return ::ioctl(fd, request, arg);
+}
+
+void Adafruit_SSD1306_LinuxIO::setDC(int8_t pin, boolean data) {
+  digitalWrite(pin, data ? HIGH : LOW);
+}
+
+// TRANSPORT BASE ----------------------------------------------------------
+
+/*!
+    @brief  Constructor for the common part of a Linux transport.
+    @param  device
+            Device path. The string must remain valid for the life of the
+            transport.
+    @param  io
+            File and pin operations to use.
+    @return Adafruit_SSD1306_LinuxTransport object.
+*/
+Adafruit_SSD1306_LinuxTransport::Adafruit_SSD1306_LinuxTransport(
+  const char *device, Adafruit_SSD1306_LinuxIO *io) : io(io),
+  device(device), fd(-1), errors(0), threaded(false), pending(false),
+  stop(false) {
+}
+
+/*!
+    @brief  Destructor, stops the thread if there is one.
+*/
+Adafruit_SSD1306_LinuxTransport::~Adafruit_SSD1306_LinuxTransport(void) {
+  stopThread();
+}
+
+// Start the thread that write() hands transfers to
+boolean Adafruit_SSD1306_LinuxTransport::startThread(void) {
+  if(threaded) return true;
+  if(sem_init(&go, 0, 0)) return false;
+  stop    = false;
+  pending = false;
+  if(pthread_create(&thread, NULL, run, this)) {
+    sem_destroy(&go);
+    return false;
+  }
+  return threaded = true;
+}
+
+// Let the transfer in progress finish, then end the thread. Derived
+// destructors call this before closing the device.
+void Adafruit_SSD1306_LinuxTransport::stopThread(void) {
+  if(!threaded) return;
+  PIPE_STORE(stop, true);
+  sem_post(&go);
+  pthread_join(thread, NULL);
+  sem_destroy(&go);
+  threaded = false;
+}
+
+void *Adafruit_SSD1306_LinuxTransport::run(void *arg) {
+  Adafruit_SSD1306_LinuxTransport *t = (Adafruit_SSD1306_LinuxTransport *)arg;
+  for(;;) {
+    while(sem_wait(&t->go)); // Retry if interrupted by a signal
+    if(PIPE_LOAD(t->stop)) break;
+    t->send(t->jobCmd, t->jobCmdLen, t->jobData, t->jobLen);
+    PIPE_STORE(t->pending, false);
+  }
+  return NULL;
+}
+
+/*!
+    @brief  Send command and data bytes to the display. Without a thread
+            (see begin()) this returns once the kernel is done with them;
+            with one, it returns at once and the thread sends them.
+    @param  cmd
+            Command bytes, or NULL if cmdLen is 0.
+    @param  cmdLen
+            Number of command bytes.
+    @param  data
+            Data bytes.
+    @param  len
+            Number of data bytes.
+    @return true, or false if the thread is still busy with the last
+            transfer. Failed transfers are dropped rather than retried (so a
+            missing display can't stall display()), and counted, see
+            getErrors().
+*/
+boolean Adafruit_SSD1306_LinuxTransport::write(const uint8_t *cmd,
+  uint8_t cmdLen, const uint8_t *data, uint16_t len) {
+  if(!threaded) {
+    send(cmd, cmdLen, data, len);
+    return true;
+  }
+  if(PIPE_LOAD(pending)) return false;
+  // The caller keeps both arrays intact until busy() is false, so the
+  // thread can send from them directly
+  jobCmd    = cmd;
+  jobCmdLen = cmdLen;
+  jobData   = data;
+  jobLen    = len;
+  PIPE_STORE(pending, true);
+  sem_post(&go);
+  return true;
+}
+
+/*!
+    @brief  Check whether a transfer is in progress. Without a thread,
+            transfers complete within write(), so never. While the thread
+            is busy this yields the CPU, so that on a single-core system
+            polling doesn't hold the thread up.
+    @return true if the thread is still sending, false if idle.
+*/
+boolean Adafruit_SSD1306_LinuxTransport::busy(void) {
+  if(!threaded || !PIPE_LOAD(pending)) return false;
+  sched_yield();
+  return true;
+}
+
+/*!
+    @brief  Get the number of transfers that failed (e.g. no acknowledge
+            from the display, or device not open).
+    @return Count since construction.
+*/
+uint32_t Adafruit_SSD1306_LinuxTransport::getErrors(void) {
+  return PIPE_LOAD(errors);
+}
+
+// I2C ---------------------------------------------------------------------
+
+/*!
+    @brief  Constructor for a Linux i2c-dev transport. Call begin() before
+            use.
+    @param  device
+            I2C bus device, e.g. "/dev/i2c-1". The string must remain valid
+            for the life of the transport.
+    @param  addr
+            Display's I2C address, usually 0x3C or 0x3D.
+    @param  io
+            File operations to use, normally the default (system calls).
+    @return Adafruit_SSD1306_LinuxI2C object.
+*/
+Adafruit_SSD1306_LinuxI2C::Adafruit_SSD1306_LinuxI2C(const char *device,
+  uint8_t addr, Adafruit_SSD1306_LinuxIO *io) :
+  Adafruit_SSD1306_LinuxTransport(device, io), addr(addr), buf(NULL),
+  bufLen(0) {
+}
+
+/*!
+    @brief  Destructor, waits for any transfer in progress and closes the
+            device.
+*/
+Adafruit_SSD1306_LinuxI2C::~Adafruit_SSD1306_LinuxI2C(void) {
+  stopThread();
+  if(fd >= 0) io->close(fd);
+  free(buf);
+}
+
+/*!
+    @brief  Open the I2C bus device.
+    @param  threaded
+            If true, also start a thread to send from, so write() returns
+            without waiting for the bus (see
+            Adafruit_SSD1306_LinuxTransport).
+    @return true on success, false if the device could not be opened or
+            the thread started.
+*/
+boolean Adafruit_SSD1306_LinuxI2C::begin(boolean threaded) {
+  if(fd < 0) fd = io->open(device, O_RDWR);
+  if(fd < 0) return false;
+  return !threaded || startThread();
+}
+
+// Send one window in one I2C_RDWR call: a write message with control byte
+// 0x00 and the commands, if any, then another with 0x40 and the data
+void Adafruit_SSD1306_LinuxI2C::send(const uint8_t *cmd, uint8_t cmdLen,
+  const uint8_t *data, uint16_t len) {
+  // Both messages go in one buffer, each led by its control byte
+  uint16_t need = (cmdLen ? (cmdLen + 1) : 0) + (len ? (len + 1) : 0);
+  if(need > bufLen) {
+    uint8_t *b = (uint8_t *)realloc(buf, need);
+    if(!b) {
+      PIPE_ADD(errors, 1);
+      return;
+    }
+    buf    = b;
+    bufLen = need;
+  }
+
+  struct i2c_msg msgs[2];
+  uint8_t        n = 0, *ptr = buf;
+  if(cmdLen) {
+    ptr[0] = 0x00; // Co = 0, D/C = 0
+    memcpy(&ptr[1], cmd, cmdLen);
+    msgs[n].addr  = addr;
+    msgs[n].flags = 0;
+    msgs[n].len   = cmdLen + 1;
+    msgs[n].buf   = ptr;
+    ptr          += cmdLen + 1;
+    n++;
+  }
+  if(len) {
+    ptr[0] = 0x40; // Co = 0, D/C = 1
+    memcpy(&ptr[1], data, len);
+    msgs[n].addr  = addr;
+    msgs[n].flags = 0;
+    msgs[n].len   = len + 1;
+    msgs[n].buf   = ptr;
+    n++;
+  }
+  if(!n) return;
+
+  struct i2c_rdwr_ioctl_data xfer = { msgs, n };
+  if((fd < 0) || (io->ioctl(fd, I2C_RDWR, &xfer) < 0)) PIPE_ADD(errors, 1);
+}
+
+// SPI ---------------------------------------------------------------------
+
+/*!
+    @brief  Constructor for a Linux spidev transport. Call begin() before
+            use.
+    @param  device
+            SPI device, e.g. "/dev/spidev0.0", whose chip select is wired
+            to the display. The string must remain valid for the life of
+            the transport.
+    @param  dc_pin
+            Data/command pin, passed to Adafruit_SSD1306_LinuxIO::setDC().
+    @param  bitrate
+            SPI clock rate, in Hz.
+    @param  io
+            File and pin operations to use, normally the default.
+    @return Adafruit_SSD1306_LinuxSPI object.
+*/
+Adafruit_SSD1306_LinuxSPI::Adafruit_SSD1306_LinuxSPI(const char *device,
+  int8_t dc_pin, uint32_t bitrate, Adafruit_SSD1306_LinuxIO *io) :
+  Adafruit_SSD1306_LinuxTransport(device, io), dcPin(dc_pin),
+  bitrate(bitrate) {
+}
+
+/*!
+    @brief  Destructor, waits for any transfer in progress and closes the
+            device.
+*/
+Adafruit_SSD1306_LinuxSPI::~Adafruit_SSD1306_LinuxSPI(void) {
+  stopThread();
+  if(fd >= 0) io->close(fd);
+}
+
+/*!
+    @brief  Open the SPI device and set mode 0, 8 bits per word and the
+            bit rate.
+    @param  threaded
+            If true, also start a thread to send from, so write() returns
+            without waiting for the bus (see
+            Adafruit_SSD1306_LinuxTransport).
+    @return true on success, false if the device could not be opened or
+            set up, or the thread started.
+*/
+boolean Adafruit_SSD1306_LinuxSPI::begin(boolean threaded) {
+  if(fd < 0) {
+    if((fd = io->open(device, O_RDWR)) < 0) return false;
+    uint8_t mode = SPI_MODE_0, bits = 8;
+    if((io->ioctl(fd, SPI_IOC_WR_MODE, &mode) < 0) ||
+       (io->ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0) ||
+       (io->ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &bitrate) < 0)) {
+      io->close(fd);
+      fd = -1;
+      return false;
+    }
+  }
+  return !threaded || startThread();
+}
+
+// Send a block of bytes in one SPI_IOC_MESSAGE call
+boolean Adafruit_SSD1306_LinuxSPI::transfer(const uint8_t *ptr,
+  uint16_t len) {
+  struct spi_ioc_transfer xfer;
+  memset(&xfer, 0, sizeof(xfer));
+  xfer.tx_buf        = (unsigned long)ptr;
+  xfer.len           = len;
+  xfer.speed_hz      = bitrate;
+  xfer.bits_per_word = 8;
+  return io->ioctl(fd, SPI_IOC_MESSAGE(1), &xfer) >= 0;
+}
+
+// D/C low and the commands, if any, then D/C high and the data, each in a
+// single SPI_IOC_MESSAGE call
+void Adafruit_SSD1306_LinuxSPI::send(const uint8_t *cmd, uint8_t cmdLen,
+  const uint8_t *data, uint16_t len) {
+  if(fd < 0) {
+    PIPE_ADD(errors, 1);
+    return;
+  }
+  if(cmdLen) {
+    io->setDC(dcPin, false);
+    if(!transfer(cmd, cmdLen)) PIPE_ADD(errors, 1);
+  }
+  if(len) {
+    io->setDC(dcPin, true);
+    if(!transfer(data, len)) PIPE_ADD(errors, 1);
+  }
+}
+
+// PIPELINE ----------------------------------------------------------------
+
+/*!
+    @brief  Constructor for a render/present pipeline. Call begin() to
+            start it.
+    @param  display
+            Display to present, on which begin() has been called. Don't
+            call its display() functions while the pipeline runs; frames
+            reach the display through submit() only.
+    @param  transport
+            Transport the presenter thread sends frames through, e.g. an
+            Adafruit_SSD1306_LinuxI2C, begun and connected to the same
+            display.
+    @param  depth
+            Frames the queue holds, 1 to SSD1306_PIPELINE_MAX.
+    @param  policy
+            What submit() does when the queue is full:
+            SSD1306_PIPELINE_DROP_OLDEST to discard the oldest queued frame,
+            or SSD1306_PIPELINE_BLOCK to wait for the presenter.
+    @param  coalesce
+            If true, the presenter sends only the newest of the frames
+            queued, skipping any older ones as already out of date. If
+            false, every queued frame is sent in turn.
+    @return Adafruit_SSD1306_Pipeline object.
+*/
+Adafruit_SSD1306_Pipeline::Adafruit_SSD1306_Pipeline(
+  Adafruit_SSD1306 *display, Adafruit_SSD1306_Transport *transport,
+  uint8_t depth, uint8_t policy, boolean coalesce) : display(display),
+  transport(transport), frames(NULL), frameBytes(0), depth(depth),
+  policy(policy), coalesce(coalesce), running(false), stop(false) {
+  resetStats();
+}
+
+/*!
+    @brief  Destructor, stops the presenter and frees the queue.
+*/
+Adafruit_SSD1306_Pipeline::~Adafruit_SSD1306_Pipeline(void) {
+  end();
+}
+
+/*!
+    @brief  Allocate the frame queue and start the presenter thread. The
+            first frame presented is sent whole, later ones only where they
+            differ from the one before.
+    @return true on success, false if depth is out of range, the display
+            is not begun or is in page-strip mode (see setBandHeight()),
+            or memory or the thread could not be had.
+*/
+boolean Adafruit_SSD1306_Pipeline::begin(void) {
+  if(running) return true;
+  if(!depth || (depth > SSD1306_PIPELINE_MAX) || !display->buffer ||
+     display->bandPages) return false;
+
+  uint8_t slots = depth + 2;
+  frameBytes    = display->WIDTH * ((display->HEIGHT + 7) / 8);
+  // A slot per queued frame, plus one being presented and one being
+  // filled by submit(), plus a copy of what's on the display
+  if(!(frames = (uint8_t *)malloc((slots + 1) * frameBytes))) return false;
+  head = tail = spareHead = 0;
+  for(uint8_t i=0; i<slots; i++) spare[i] = i;
+  spareTail = slots;
+  owned     = -1;
+  sentValid = false;
+  stop      = false;
+  boolean ok = false;
+  if(!sem_init(&ready, 0, 0)) {
+    if(!sem_init(&room, 0, 0)) {
+      if(!pthread_create(&thread, NULL, run, this)) ok = true;
+      else sem_destroy(&room);
+    }
+    if(!ok) sem_destroy(&ready);
+  }
+  if(!ok) {
+    free(frames);
+    frames = NULL;
+    return false;
+  }
+  return running = true;
+}
+
+/*!
+    @brief  Stop the presenter thread, once it has sent any frames still
+            queued, and free the queue.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Pipeline::end(void) {
+  if(!running) return;
+  PIPE_STORE(stop, true);
+  sem_post(&ready);
+  pthread_join(thread, NULL);
+  sem_destroy(&ready);
+  sem_destroy(&room);
+  free(frames);
+  frames  = NULL;
+  running = false;
+}
+
+/*!
+    @brief  Queue the display's buffer as the next frame to present and
+            return, leaving the buffer free for drawing the following one.
+            Call from one thread only.
+    @return true if queued, false if the pipeline isn't running.
+    @note   With SSD1306_PIPELINE_BLOCK this waits while the queue is full;
+            with SSD1306_PIPELINE_DROP_OLDEST it never waits on the bus.
+*/
+boolean Adafruit_SSD1306_Pipeline::submit(void) {
+  if(!running) return false;
+
+  int8_t slot = owned;
+  owned = -1;
+  // A slot is free unless the presenter is between taking a newer frame
+  // and giving back the one it replaces
+  if(slot < 0) while((slot = popSpare()) < 0) sched_yield();
+  memcpy(&frames[slot * frameBytes], display->buffer, frameBytes);
+  stamp[slot] = micros();
+  PIPE_ADD(submitted, 1);
+
+  uint32_t t = tail;
+  for(;;) {
+    uint32_t h = PIPE_LOAD(head);
+    if((t - h) < depth) break;
+    if(policy == SSD1306_PIPELINE_BLOCK) {
+      // Posts from frames taken while nobody waited are stale, so clear
+      // them and look again before sleeping until the next one is taken
+      while(!sem_trywait(&room));
+      if((t - PIPE_LOAD(head)) >= depth) sem_wait(&room);
+      continue;
+    }
+    // Take the oldest frame back, unless the presenter gets it first
+    uint8_t old = __atomic_load_n(&queue[h % depth], __ATOMIC_RELAXED);
+    if(PIPE_CAS(head, h, h + 1)) {
+      owned = old;
+      PIPE_ADD(dropped, 1);
+      break;
+    }
+  }
+  __atomic_store_n(&queue[t % depth], (uint8_t)slot, __ATOMIC_RELAXED);
+  PIPE_STORE(tail, t + 1);
+  sem_post(&ready);
+  return true;
+}
+
+// Take the next frame off the queue for presenting, or with coalesce set
+// the newest, giving back any older ones. Returns the slot, or -1 if the
+// queue is empty.
+int8_t Adafruit_SSD1306_Pipeline::take(void) {
+  int8_t slot = -1;
+  for(;;) {
+    uint32_t h = PIPE_LOAD(head);
+    if(h == PIPE_LOAD(tail)) break;
+    uint8_t s = __atomic_load_n(&queue[h % depth], __ATOMIC_RELAXED);
+    if(!PIPE_CAS(head, h, h + 1)) continue; // Dropped by submit()
+    // Only a blocking submit() waits for room, a dropping one makes it
+    if(policy == SSD1306_PIPELINE_BLOCK) sem_post(&room);
+    if(slot >= 0) {
+      pushSpare(slot);
+      PIPE_ADD(coalesced, 1);
+    }
+    slot = s;
+    if(!coalesce) break;
+  }
+  return slot;
+}
+
+// Free slots go back from the presenter to submit() through a second
+// ring, large enough for all of them.
+int8_t Adafruit_SSD1306_Pipeline::popSpare(void) {
+  uint32_t h = spareHead;
+  if(h == PIPE_LOAD(spareTail)) return -1;
+  int8_t slot = spare[h % (depth + 2)];
+  PIPE_STORE(spareHead, h + 1);
+  return slot;
+}
+
+void Adafruit_SSD1306_Pipeline::pushSpare(uint8_t slot) {
+  uint32_t t = spareTail;
+  spare[t % (depth + 2)] = slot;
+  PIPE_STORE(spareTail, t + 1);
+}
+
+// Presenter thread: wait for frames and send them until end() is called
+// and the queue is empty.
+void *Adafruit_SSD1306_Pipeline::run(void *arg) {
+  Adafruit_SSD1306_Pipeline *p = (Adafruit_SSD1306_Pipeline *)arg;
+  for(;;) {
+    sem_wait(&p->ready);
+    int8_t slot = p->take();
+    if(slot >= 0) {
+      p->present(slot);
+      p->pushSpare(slot);
+    } else if(PIPE_LOAD(p->stop)) {
+      break;
+    }
+  }
+  return NULL;
+}
+
+// Send a frame's changes from what's on the display: one window per
+// changed page spanning its changed columns, except that consecutive
+// pages changed across their full width go as a single window.
+void Adafruit_SSD1306_Pipeline::present(uint8_t slot) {
+  const uint8_t *frame = &frames[slot * frameBytes];
+  uint8_t       *sent  = &frames[(depth + 2) * frameBytes];
+  uint8_t        w     = display->WIDTH,
+                 pages = frameBytes / w;
+  uint8_t        cmd[6];
+
+  for(uint8_t page=0; page<pages; ) {
+    const uint8_t *a = &frame[page * w], *b = &sent[page * w];
+    int16_t x1 = 0, x2 = w - 1;
+    if(sentValid) {
+      while((x1 < w) && (a[x1] == b[x1])) x1++;
+      if(x1 == w) { // Unchanged
+        page++;
+        continue;
+      }
+      while(a[x2] == b[x2]) x2--;
+    }
+    uint8_t page2 = page;
+    if((x1 == 0) && (x2 == (w - 1))) {
+      while(((page2 + 1) < pages) && (!sentValid ||
+        ((frame[(page2 + 1) * w] != sent[(page2 + 1) * w]) &&
+         (frame[(page2 + 2) * w - 1] != sent[(page2 + 2) * w - 1]))))
+        page2++;
+    }
+    cmd[0] = SSD1306_PAGEADDR;
+    cmd[1] = page;
+    cmd[2] = page2;
+    cmd[3] = SSD1306_COLUMNADDR;
+    cmd[4] = x1;
+    cmd[5] = x2;
+    while(!transport->write(cmd, sizeof(cmd), &frame[page * w + x1],
+      (x2 - x1 + 1) * (page2 - page + 1))) sched_yield();
+    // cmd is reused by the next write, and the frame slot by submit()
+    // once returned, so wait for each transfer to finish
+    while(transport->busy()) sched_yield();
+    page = page2 + 1;
+  }
+  memcpy(sent, frame, frameBytes);
+  sentValid = true;
+
+  uint32_t latency = micros() - stamp[slot];
+  PIPE_ADD(presented, 1);
+  PIPE_ADD(latencySum, latency);
+  uint32_t m = PIPE_LOAD(maxLatency);
+  while((latency > m) && !PIPE_CAS(maxLatency, m, latency));
+}
+
+/*!
+    @brief  Get frame counts and latencies since the pipeline was
+            constructed or resetStats() was called. Safe to call while the
+            presenter runs.
+    @return SSD1306_PipelineStats, by value.
+*/
+SSD1306_PipelineStats Adafruit_SSD1306_Pipeline::getStats(void) {
+  SSD1306_PipelineStats s;
+  s.submitted  = PIPE_LOAD(submitted);
+  s.presented  = PIPE_LOAD(presented);
+  s.dropped    = PIPE_LOAD(dropped);
+  s.coalesced  = PIPE_LOAD(coalesced);
+  s.maxLatency = PIPE_LOAD(maxLatency);
+  uint64_t sum = PIPE_LOAD(latencySum);
+  s.latency    = s.presented ? (uint32_t)(sum / s.presented) : 0;
+  return s;
+}
+
+/*!
+    @brief  Zero the counters returned by getStats().
+    @return None (void).
+*/
+void Adafruit_SSD1306_Pipeline::resetStats(void) {
+  PIPE_STORE(submitted , 0);
+  PIPE_STORE(presented , 0);
+  PIPE_STORE(dropped   , 0);
+  PIPE_STORE(coalesced , 0);
+  PIPE_STORE(maxLatency, 0);
+  PIPE_STORE(latencySum, (uint64_t)0);
+}
+
+#endif // __linux__
@@ -0,0 +1,250 @@
+/*!
+ * @file Adafruit_SSD1306_Linux.h
+ *
+ * Part of Adafruit's SSD1306 library. Transports for running displays
+ * from Linux userspace through the i2c-dev and spidev interfaces, see
+ * Adafruit_SSD1306::setTransport(). Each frame window goes to the kernel
+ * in a single ioctl() call rather than one per Wire-buffer-sized chunk.
+ * Also a pipeline to send frames from a thread of their own.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Linux_H_
+#define _Adafruit_SSD1306_Linux_H_
+
+#if defined(__linux__)
+
+#include <pthread.h>
+#include <semaphore.h>
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_PIPELINE_BLOCK       0 ///< submit() waits for a free slot
+#define SSD1306_PIPELINE_DROP_OLDEST 1 ///< submit() discards oldest frame
+
+#if !defined(SSD1306_PIPELINE_MAX)
+ #define SSD1306_PIPELINE_MAX        8 ///< Most frames a pipeline can queue
+#endif
+
+/*!
+    @brief  Frame counts and latencies of an Adafruit_SSD1306_Pipeline.
+*/
+typedef struct {
+  uint32_t submitted;  ///< Frames passed to submit()
+  uint32_t presented;  ///< Frames sent to the display
+  uint32_t dropped;    ///< Frames discarded by submit() as the queue was full
+  uint32_t coalesced;  ///< Frames skipped by the presenter as a newer one
+                       ///< was already queued
+  uint32_t latency;    ///< Mean submit() to sent, in microseconds
+  uint32_t maxLatency; ///< Longest submit() to sent, in microseconds
+} SSD1306_PipelineStats;
+
+/*!
+    @brief  File and pin operations used by the Linux transports. The
+            default passes them on to the system; derive from this to
+            substitute a fake device, e.g. for testing without a bus.
+*/
+class Adafruit_SSD1306_LinuxIO {
+ public:
+  virtual ~Adafruit_SSD1306_LinuxIO(void) {}
+  /*!
+      @brief  Open a device, as open(2).
+      @param  path
+              Device path, e.g. "/dev/i2c-1".
+      @param  flags
+              Open flags.
+      @return File descriptor, or -1 on error.
+  */
+  virtual int open(const char *path, int flags);
+  /*!
+      @brief  Close a device, as close(2).
+      @param  fd
+              File descriptor from open().
+      @return 0 on success, -1 on error.
+  */
+  virtual int close(int fd);
+  /*!
+      @brief  Device control, as ioctl(2).
+      @param  fd
+              File descriptor from open().
+      @param  request
+              Request code, e.g. I2C_RDWR.
+      @param  arg
+              Request argument.
+      @return Request-specific, -1 on error.
+  */
+  virtual int ioctl(int fd, unsigned long request, void *arg);
+  /*!
+      @brief  Set the level of the SPI display's data/command pin.
+      @param  pin
+              Pin number given to the transport.
+      @param  data
+              true for data (high), false for commands (low).
+      @return None (void).
+  */
+  virtual void setDC(int8_t pin, boolean data);
+
+  static Adafruit_SSD1306_LinuxIO system; ///< Default, real devices
+};
+
+/*!
+    @brief  Common part of the Linux transports: the device, its error
+            count and, if begin() is asked for one, a thread of the
+            transport's own. Without the thread each write() completes
+            before returning. With it, write() hands the transfer to the
+            thread and returns at once, and busy() is true until the kernel
+            is done, so displays on different buses, e.g. the tiles of an
+            Adafruit_SSD1306_Tiled, are sent to concurrently. Link with
+            -pthread.
+*/
+class Adafruit_SSD1306_LinuxTransport : public Adafruit_SSD1306_Transport {
+ public:
+  virtual ~Adafruit_SSD1306_LinuxTransport(void);
+
+  boolean  write(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+             uint16_t len);
+  boolean  busy(void);
+  uint32_t getErrors(void);
+
+ protected:
+  Adafruit_SSD1306_LinuxTransport(const char *device,
+    Adafruit_SSD1306_LinuxIO *io);
+  boolean  startThread(void);
+  void     stopThread(void);
+  /*!
+      @brief  Send command and data bytes to the display and wait for the
+              kernel to finish, counting any failure in errors.
+      @param  cmd
+              Command bytes, or NULL if cmdLen is 0.
+      @param  cmdLen
+              Number of command bytes.
+      @param  data
+              Data bytes.
+      @param  len
+              Number of data bytes.
+      @return None (void).
+  */
+  virtual void send(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+                 uint16_t len) = 0;
+  Adafruit_SSD1306_LinuxIO *io;
+  const char *device;
+  int         fd;
+  uint32_t    errors;   // Failed transfers, updated atomically
+
+ private:
+  static void *run(void *arg);
+  const uint8_t *jobCmd;   // Transfer handed to the thread by write()
+  const uint8_t *jobData;
+  uint8_t        jobCmdLen;
+  uint16_t       jobLen;
+  boolean        threaded; // Thread started
+  boolean        pending;  // Transfer handed over and not yet done
+  boolean        stop;     // Set by stopThread() to end the thread
+  sem_t          go;       // Posted per transfer handed over
+  pthread_t      thread;
+};
+
+/*!
+    @brief  Transport for an SSD1306 on a Linux I2C bus (i2c-dev). A
+            window's command and data bytes go to the kernel together in
+            one I2C_RDWR call, as two write messages.
+*/
+class Adafruit_SSD1306_LinuxI2C : public Adafruit_SSD1306_LinuxTransport {
+ public:
+  Adafruit_SSD1306_LinuxI2C(const char *device, uint8_t addr,
+    Adafruit_SSD1306_LinuxIO *io=&Adafruit_SSD1306_LinuxIO::system);
+  ~Adafruit_SSD1306_LinuxI2C(void);
+
+  boolean  begin(boolean threaded=false);
+
+ private:
+  void     send(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+             uint16_t len);
+  uint8_t     addr;
+  uint8_t    *buf;    // Control bytes + command and data, for one ioctl()
+  uint16_t    bufLen; // Allocated size of buf
+};
+
+/*!
+    @brief  Transport for an SSD1306 on a Linux SPI bus (spidev). The D/C
+            pin is set through Adafruit_SSD1306_LinuxIO::setDC(), then the
+            command bytes and the data bytes each go to the kernel in one
+            SPI_IOC_MESSAGE call.
+*/
+class Adafruit_SSD1306_LinuxSPI : public Adafruit_SSD1306_LinuxTransport {
+ public:
+  Adafruit_SSD1306_LinuxSPI(const char *device, int8_t dc_pin,
+    uint32_t bitrate=8000000UL,
+    Adafruit_SSD1306_LinuxIO *io=&Adafruit_SSD1306_LinuxIO::system);
+  ~Adafruit_SSD1306_LinuxSPI(void);
+
+  boolean  begin(boolean threaded=false);
+
+ private:
+  void     send(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+             uint16_t len);
+  boolean  transfer(const uint8_t *ptr, uint16_t len);
+  int8_t      dcPin;
+  uint32_t    bitrate;
+};
+
+/*!
+    @brief  Renders and presents on separate threads. The application draws
+            into the display's buffer as usual and calls submit(), which
+            copies the frame into a queue and returns; a presenter thread
+            takes frames off the queue and sends the bytes that changed
+            through a transport, so bus time no longer holds up drawing.
+            The queue is a lock-free single-producer/single-consumer ring:
+            submit() must only be called from one thread. Link with
+            -pthread.
+*/
+class Adafruit_SSD1306_Pipeline {
+ public:
+  Adafruit_SSD1306_Pipeline(Adafruit_SSD1306 *display,
+    Adafruit_SSD1306_Transport *transport, uint8_t depth=2,
+    uint8_t policy=SSD1306_PIPELINE_DROP_OLDEST, boolean coalesce=true);
+  ~Adafruit_SSD1306_Pipeline(void);
+
+  boolean  begin(void);
+  void     end(void);
+  boolean  submit(void);
+  SSD1306_PipelineStats getStats(void);
+  void     resetStats(void);
+
+ private:
+  static void *run(void *arg);
+  void     present(uint8_t slot);
+  int8_t   take(void);
+  int8_t   popSpare(void);
+  void     pushSpare(uint8_t slot);
+  Adafruit_SSD1306           *display;
+  Adafruit_SSD1306_Transport *transport;
+  uint8_t  *frames;     // depth + 2 frame slots, then copy of display RAM
+  uint16_t  frameBytes; // WIDTH * pages
+  uint8_t   depth;      // Frames the queue holds
+  uint8_t   policy;     // SSD1306_PIPELINE_BLOCK or _DROP_OLDEST
+  boolean   coalesce;   // Present only the newest of the queued frames
+  boolean   running;    // Presenter thread started
+  boolean   stop;       // Set by end() to stop the presenter
+  boolean   sentValid;  // Copy of display RAM is known
+  int8_t    owned;      // Slot submit() reclaimed by dropping, or -1
+  // Queued slots, producer to presenter. head is advanced (by CAS) by the
+  // presenter taking a frame or submit() dropping one; tail by submit().
+  uint8_t   queue[SSD1306_PIPELINE_MAX];
+  uint32_t  head, tail;
+  // Free slots, presenter to producer
+  uint8_t   spare[SSD1306_PIPELINE_MAX + 2];
+  uint32_t  spareHead, spareTail;
+  uint32_t  stamp[SSD1306_PIPELINE_MAX + 2]; // micros() at submit(), by slot
+  sem_t     ready;      // Posted per frame queued
+  sem_t     room;       // Posted per frame taken off the queue (BLOCK)
+  pthread_t thread;
+  // Statistics, updated atomically
+  uint32_t  submitted, presented, dropped, coalesced, maxLatency;
+  uint64_t  latencySum;
+};
+
+#endif // __linux__
+
+#endif // _Adafruit_SSD1306_Linux_H_
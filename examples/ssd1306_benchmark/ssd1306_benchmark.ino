@@ -0,0 +1,366 @@
+/**************************************************************************
+ This is a benchmark for our Monochrome OLEDs based on SSD1306 drivers
+
+ Pick one up today in the adafruit shop!
+ ------> http://www.adafruit.com/category/63_98
+
+ This sketch times the library's drawing primitives and screen updates
+ on the actual microcontroller and bus in use, and prints the results to
+ the Serial Monitor (115200 baud). It's meant for comparing boards, bus
+ speeds and library changes, so it runs each test once and then stops.
+
+ It also compares ways of putting the full-size splash image on screen:
+ drawn with drawBitmap() or blit() then sent with display(), or the
+ page-major versions generated by scripts/make_splash.py.
+
+ The last part replays the drawing sequence of the ssd1306_128x64_i2c
+ example (minus its delays), separating time spent drawing into the
+ buffer from time spent in display().
+
+ Adafruit invests time and resources providing this open
+ source code, please support Adafruit and open-source
+ hardware by purchasing products from Adafruit!
+
+ Written by Limor Fried/Ladyada for Adafruit Industries,
+ with contributions from the open source community.
+ BSD license, check license.txt for more information
+ All text above, and the splash screen below must be
+ included in any redistribution.
+ **************************************************************************/
+
+#include <SPI.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <splash.h> // Library's splash, in all make_splash.py formats
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     4 // Reset pin # (or -1 if sharing Arduino reset pin)
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+
+#define LOGO_HEIGHT   16
+#define LOGO_WIDTH    16
+static const unsigned char PROGMEM logo_bmp[] =
+{ B00000000, B11000000,
+  B00000001, B11000000,
+  B00000001, B11000000,
+  B00000011, B11100000,
+  B11110011, B11100000,
+  B11111110, B11111000,
+  B01111110, B11111111,
+  B00110011, B10011111,
+  B00011111, B11111100,
+  B00001101, B01110000,
+  B00011011, B10100000,
+  B00111111, B11100000,
+  B00111111, B11110000,
+  B01111100, B11110000,
+  B01110000, B01110000,
+  B00000000, B00110000 };
+
+uint32_t drawTime, showTime; // Accumulated by replay functions below
+
+void setup() {
+  Serial.begin(115200);
+
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3D)) { // Address 0x3D for 128x64
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;); // Don't proceed, loop forever
+  }
+  display.display();
+
+  Serial.println(F("Benchmark                          Time (microseconds)"));
+
+  for(uint8_t r=0; r<4; r++) {
+    display.setRotation(r);
+    Serial.print(F("Rotation ")); Serial.println(r);
+    report(F("  drawPixel, full screen"), benchPixels());
+    report(F("  drawFastHLine, full screen"), benchHLines());
+    report(F("  drawFastVLine, full screen"), benchVLines());
+    report(F("  fillRect, 100 random"), benchFillRects());
+  }
+  display.setRotation(0);
+
+  report(F("clearDisplay, empty buffer"), benchClear(false));
+  report(F("clearDisplay, full buffer"), benchClear(true));
+  report(F("drawBitmap, 16x16 logo"), benchBitmap());
+  report(F("blit, 16x16 logo"), benchBlit());
+  report(F("display(), full frame"), benchDisplayFull());
+  report(F("display(), one pixel changed"), benchDisplayPixel());
+  report(F("display(), nothing changed"), benchDisplayNone());
+
+  Serial.println(F("Splash image, drawing + upload"));
+  report(F("  drawBitmap() + display()"), benchSplash(0));
+  report(F("  blit() + display()"), benchSplash(1));
+  report(F("  drawPageImage() + display()"), benchSplash(2));
+  report(F("  drawPageImage(), RLE + display()"), benchSplash(3));
+  report(F("  sendPageImage()"), benchSplash(4));
+  report(F("  sendPageImage(), RLE"), benchSplash(5));
+
+  Serial.println(F("Replay of ssd1306_128x64_i2c example"));
+  drawTime = showTime = 0;
+  replayLines();
+  replayRects();
+  replayCircles();
+  replayTriangles();
+  replayText();
+  replaySnow(50);
+  report(F("  drawing"), drawTime);
+  report(F("  display()"), showTime);
+
+  display.clearDisplay();
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+  display.setCursor(0, 0);
+  display.println(F("Benchmark done"));
+  display.display();
+}
+
+void loop() {
+}
+
+void report(const __FlashStringHelper *label, uint32_t t) {
+  Serial.print(label);
+  Serial.print(F(": "));
+  Serial.println(t);
+}
+
+// PRIMITIVES --------------------------------------------------------------
+
+uint32_t benchPixels(void) {
+  uint32_t t = micros();
+  for(int16_t y=0; y<display.height(); y++) {
+    for(int16_t x=0; x<display.width(); x++) {
+      display.drawPixel(x, y, SSD1306_INVERSE);
+    }
+  }
+  return micros() - t;
+}
+
+uint32_t benchHLines(void) {
+  uint32_t t = micros();
+  for(int16_t y=0; y<display.height(); y++) {
+    display.drawFastHLine(0, y, display.width(), SSD1306_INVERSE);
+  }
+  return micros() - t;
+}
+
+uint32_t benchVLines(void) {
+  uint32_t t = micros();
+  for(int16_t x=0; x<display.width(); x++) {
+    display.drawFastVLine(x, 0, display.height(), SSD1306_INVERSE);
+  }
+  return micros() - t;
+}
+
+uint32_t benchFillRects(void) {
+  randomSeed(1); // Same rectangles every time
+  uint32_t t = micros();
+  for(uint8_t i=0; i<100; i++) {
+    display.fillRect(random(display.width()), random(display.height()),
+      random(display.width()), random(display.height()), SSD1306_INVERSE);
+  }
+  return micros() - t;
+}
+
+uint32_t benchClear(bool full) {
+  if(full) display.fillScreen(SSD1306_WHITE);
+  uint32_t t = micros();
+  display.clearDisplay();
+  return micros() - t;
+}
+
+uint32_t benchBitmap(void) {
+  display.clearDisplay();
+  uint32_t t = micros();
+  display.drawBitmap((display.width()  - LOGO_WIDTH ) / 2,
+                     (display.height() - LOGO_HEIGHT) / 2 + 3,
+                     logo_bmp, LOGO_WIDTH, LOGO_HEIGHT, SSD1306_WHITE);
+  return micros() - t;
+}
+
+uint32_t benchBlit(void) {
+  display.clearDisplay();
+  uint32_t t = micros();
+  display.blit((display.width()  - LOGO_WIDTH ) / 2,
+               (display.height() - LOGO_HEIGHT) / 2 + 3,
+               logo_bmp, LOGO_WIDTH, LOGO_HEIGHT);
+  return micros() - t;
+}
+
+// SPLASH IMAGE ------------------------------------------------------------
+
+// Put the 82x64 splash in the middle of a cleared screen, one of six ways.
+// Time includes the upload, which is only the changed columns in each case.
+uint32_t benchSplash(uint8_t method) {
+  int16_t x = (display.width() - splash1_width) / 2;
+  display.clearDisplay();
+  display.display();
+  uint32_t t = micros();
+  switch(method) {
+   case 0:
+    display.drawBitmap(x, 0, splash1_data, splash1_width, splash1_height,
+      SSD1306_WHITE);
+    break;
+   case 1:
+    display.blit(x, 0, splash1_data, splash1_width, splash1_height);
+    break;
+   case 2:
+    display.drawPageImage(x, 0, splash1_page_data, splash1_width,
+      splash1_pages);
+    break;
+   case 3:
+    display.drawPageImage(x, 0, splash1_rle_data, splash1_width,
+      splash1_pages, true);
+    break;
+   case 4:
+    display.sendPageImage(x, 0, splash1_page_data, splash1_width,
+      splash1_pages);
+    return micros() - t;
+   case 5:
+    display.sendPageImage(x, 0, splash1_rle_data, splash1_width,
+      splash1_pages, true);
+    return micros() - t;
+  }
+  display.display();
+  return micros() - t;
+}
+
+// SCREEN UPDATES ----------------------------------------------------------
+
+uint32_t benchDisplayFull(void) {
+  display.fillScreen(SSD1306_INVERSE); // Changes every byte
+  uint32_t t = micros();
+  display.display();
+  return micros() - t;
+}
+
+uint32_t benchDisplayPixel(void) {
+  display.drawPixel(display.width() / 2, display.height() / 2,
+    SSD1306_INVERSE);
+  uint32_t t = micros();
+  display.display();
+  return micros() - t;
+}
+
+uint32_t benchDisplayNone(void) {
+  uint32_t t = micros();
+  display.display();
+  return micros() - t;
+}
+
+// EXAMPLE REPLAY ----------------------------------------------------------
+
+// Time a display() call, adding the time since the prior call (or since
+// the start of a replay function) to the drawing total.
+uint32_t mark;
+
+void startReplay(void) {
+  display.clearDisplay();
+  mark = micros();
+}
+
+void show(void) {
+  uint32_t t = micros();
+  drawTime += t - mark;
+  display.display();
+  mark      = micros();
+  showTime += mark - t;
+}
+
+void replayLines(void) {
+  startReplay();
+  for(int16_t i=0; i<display.width(); i+=4) {
+    display.drawLine(0, 0, i, display.height()-1, SSD1306_WHITE);
+    show();
+  }
+  for(int16_t i=0; i<display.height(); i+=4) {
+    display.drawLine(0, 0, display.width()-1, i, SSD1306_WHITE);
+    show();
+  }
+}
+
+void replayRects(void) {
+  startReplay();
+  for(int16_t i=0; i<display.height()/2; i+=2) {
+    display.drawRect(i, i, display.width()-2*i, display.height()-2*i,
+      SSD1306_WHITE);
+    show();
+  }
+  startReplay();
+  for(int16_t i=0; i<display.height()/2; i+=3) {
+    display.fillRect(i, i, display.width()-i*2, display.height()-i*2,
+      SSD1306_INVERSE);
+    show();
+  }
+}
+
+void replayCircles(void) {
+  startReplay();
+  for(int16_t i=0; i<max(display.width(),display.height())/2; i+=2) {
+    display.drawCircle(display.width()/2, display.height()/2, i,
+      SSD1306_WHITE);
+    show();
+  }
+  startReplay();
+  for(int16_t i=max(display.width(),display.height())/2; i>0; i-=3) {
+    display.fillCircle(display.width() / 2, display.height() / 2, i,
+      SSD1306_INVERSE);
+    show();
+  }
+}
+
+void replayTriangles(void) {
+  startReplay();
+  for(int16_t i=max(display.width(),display.height())/2; i>0; i-=5) {
+    display.fillTriangle(
+      display.width()/2  , display.height()/2-i,
+      display.width()/2-i, display.height()/2+i,
+      display.width()/2+i, display.height()/2+i, SSD1306_INVERSE);
+    show();
+  }
+}
+
+void replayText(void) {
+  startReplay();
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+  display.setCursor(0, 0);
+  display.cp437(true);
+  for(int16_t i=0; i<256; i++) {
+    if(i == '\n') display.write(' ');
+    else          display.write(i);
+  }
+  show();
+}
+
+void replaySnow(uint8_t frames) {
+  int16_t x[10], y[10], dy[10];
+  randomSeed(1);
+  for(uint8_t f=0; f<10; f++) {
+    x[f]  = random(1 - LOGO_WIDTH, display.width());
+    y[f]  = -LOGO_HEIGHT;
+    dy[f] = random(1, 6);
+  }
+  startReplay();
+  while(frames--) {
+    display.clearDisplay();
+    for(uint8_t f=0; f<10; f++) {
+      display.drawBitmap(x[f], y[f], logo_bmp, LOGO_WIDTH, LOGO_HEIGHT,
+        SSD1306_WHITE);
+    }
+    show();
+    for(uint8_t f=0; f<10; f++) {
+      y[f] += dy[f];
+      if(y[f] >= display.height()) {
+        x[f]  = random(1 - LOGO_WIDTH, display.width());
+        y[f]  = -LOGO_HEIGHT;
+        dy[f] = random(1, 6);
+      }
+    }
+  }
+}
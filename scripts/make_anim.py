@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# pip install pillow to get the PIL module
+#
+# Converts a sequence of images (all the same size) to an animation for
+# the library's startAnimation() and nextAnimationFrame(). The first frame
+# is stored whole, every later one as the bytes that differ from the frame
+# before it, so a frame costs flash and transfer time in proportion to how
+# much of it changes. A last delta leads back to the first frame, so the
+# animation can loop without redrawing it.
+#
+# Data format, all in the display's page-major layout (see make_splash.py):
+#   width, pages, frame count (2 bytes, LSB first)
+#   first frame, width * pages bytes, run-length encoded
+#   for each frame (the last one leading back to the first):
+#     zero or more spans, each:
+#       page, column, count (1 to width)
+#       count bytes to XOR into the image, run-length encoded
+#     0xFF
+# Compression ratio reported is against storing every frame unencoded.
+
+import argparse
+import os
+import sys
+from PIL import Image
+from make_splash import page_bytes, print_bytes, rle
+
+# Changed bytes this close together are sent as one span, as a span's
+# header costs 3 bytes and its own window on the bus
+GAP = 4
+
+def spans(delta, width, pages):
+  out = []
+  for page in range(pages):
+    row, x = delta[page * width:(page + 1) * width], 0
+    while x < width:
+      if not row[x]:
+        x += 1
+        continue
+      start = end = x
+      while x < width and (row[x] or any(row[x:x + GAP])):
+        if row[x]:
+          end = x
+        x += 1
+      out.append((page, start, row[start:end + 1]))
+  return out
+
+def main(files, id):
+  images = [Image.open(fn) for fn in files]
+  width, height = images[0].width, images[0].height
+  for fn, image in zip(files, images):
+    if (image.width, image.height) != (width, height):
+      sys.exit('{}: size differs from first frame'.format(fn))
+  pages  = (height + 7) // 8
+  frames = [page_bytes(image) for image in images]
+
+  data = [width, pages, len(frames) & 0xFF, len(frames) >> 8]
+  data.extend(rle(frames[0]))
+  nspans = 0
+  for i in range(len(frames)):
+    cur, nxt = frames[i], frames[(i + 1) % len(frames)]
+    for page, x, xor in spans([a ^ b for a, b in zip(cur, nxt)],
+                              width, pages):
+      data.extend([page, x, len(xor)])
+      data.extend(rle(xor))
+      nspans += 1
+    data.append(0xFF)
+
+  raw = width * pages * len(frames)
+  print("\n"
+        "#define {id}_width  {w}\n"
+        "#define {id}_height {h}\n"
+        "#define {id}_frames {n}\n"
+        "\n"
+        "// {n} frames, {s} spans, {b} bytes ({r} unpacked)\n"
+        "const uint8_t PROGMEM {id}_anim[] = {{"
+        .format(id=id, w=width, h=height, n=len(frames), s=nspans,
+                b=len(data), r=raw))
+  print_bytes(data)
+  print("};")
+  sys.stderr.write('{}: {} frames, {}x{}, {} bytes, {} unpacked, '
+                   'ratio {:.1f}:1\n'.format(id, len(frames), width, height,
+                                             len(data), raw,
+                                             raw / len(data)))
+
+if __name__ == '__main__':
+  ap = argparse.ArgumentParser(description='Convert images to animation')
+  ap.add_argument('images', nargs='+',
+                  help='frame image files in order, or a directory of them '
+                       '(played in file name order)')
+  ap.add_argument('--id', default='anim',
+                  help='prefix for generated names (default anim)')
+  args = ap.parse_args()
+  files = args.images
+  if len(files) == 1 and os.path.isdir(files[0]):
+    files = sorted(os.path.join(files[0], fn) for fn in os.listdir(files[0])
+                   if fn.lower().endswith(('.png', '.bmp', '.gif')))
+  if not files:
+    sys.exit('no images')
+  main(files, args.id)
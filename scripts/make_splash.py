@@ -1,10 +1,64 @@
 #!/usr/bin/env python3
 # pip install pillow to get the PIL module
+#
+# Converts an image to C arrays for the library. Always emits {id}_data,
+# the row-major bitmap format used by drawBitmap() and blit(). Optionally
+# also emits the image in the SSD1306's own page-major layout (one byte
+# per 8-pixel column of each page, LSB at top), as used by
+# drawPageImage() and sendPageImage(), either as-is or run-length encoded.
+#
+# RLE format, repeated until the image's width * pages bytes are decoded:
+#   0x00-0x7F  N: the next N+1 bytes are literal image data
+#   0x80-0xFF  N: the next byte is repeated (N & 0x7F) + 2 times
 
-import sys
+import argparse
 from PIL import Image
 
-def main(fn, id):
+def pixel(image, x, y):
+  return x < image.width and y < image.height and image.getpixel((x,y)) != 0
+
+def page_bytes(image):
+  # Page-major layout, image height padded to a multiple of 8 rows
+  out = []
+  for page in range(0, (image.height + 7)//8):
+    for x in range(0, image.width):
+      b = 0
+      for bit in range(0, 8):
+        if pixel(image, x, page * 8 + bit):
+          b |= 1 << bit
+      out.append(b)
+  return out
+
+def rle(data):
+  out, lit, i = [], [], 0
+  def flush():
+    if lit:
+      out.append(len(lit) - 1)
+      out.extend(lit)
+      del lit[:]
+  while i < len(data):
+    run = 1
+    while i + run < len(data) and data[i + run] == data[i] and run < 129:
+      run += 1
+    # A run of 2 is only worth encoding if it doesn't split a literal
+    if run >= 3 or (run == 2 and not lit):
+      flush()
+      out.extend([0x80 | (run - 2), data[i]])
+      i += run
+    else:
+      lit.append(data[i])
+      if len(lit) == 128:
+        flush()
+      i += 1
+  flush()
+  return out
+
+def print_bytes(data, per_line=16):
+  for i in range(0, len(data), per_line):
+    print("  " + "".join("0x{:02X},".format(b)
+                         for b in data[i:i + per_line]))
+
+def main(fn, id, pages, compress):
   image = Image.open(fn)
   print("\n"
         "#define {id}_width  {w}\n"
@@ -20,7 +74,7 @@ def main(fn, id):
         print("B", end='')
 
       bit = '0'
-      if x < image.width and image.getpixel((x,y)) != 0:
+      if pixel(image, x, y):
         bit = '1'
       print(bit, end='')
 
@@ -29,10 +83,35 @@ def main(fn, id):
     print()
   print("};")
 
+  if pages or compress:
+    data = page_bytes(image)
+    print("\n"
+          "#define {id}_pages  {p}\n"
+          .format(id=id, p=(image.height + 7)//8), end='')
+  if pages:
+    print("\n"
+          "// Page-major, {n} bytes\n"
+          "const uint8_t PROGMEM {id}_page_data[] = {{"
+          .format(id=id, n=len(data)))
+    print_bytes(data)
+    print("};")
+  if compress:
+    packed = rle(data)
+    print("\n"
+          "// Page-major, run-length encoded, {n} bytes ({u} unpacked)\n"
+          "const uint8_t PROGMEM {id}_rle_data[] = {{"
+          .format(id=id, n=len(packed), u=len(data)))
+    print_bytes(packed)
+    print("};")
+
 if __name__ == '__main__':
-    if len(sys.argv) < 3:
-      print("Usage: {} <imagefile> <id>\n".format(sys.argv[0]), file=sys.stderr);
-      sys.exit(1)
-    fn = sys.argv[1]
-    id = sys.argv[2]
-    main(fn, id)
+  ap = argparse.ArgumentParser(description='Convert image to C arrays')
+  ap.add_argument('imagefile')
+  ap.add_argument('id', help='prefix for generated names')
+  ap.add_argument('--pages', action='store_true',
+                  help='also emit page-major data ({id}_page_data)')
+  ap.add_argument('--rle', action='store_true',
+                  help='also emit run-length encoded page-major data '
+                       '({id}_rle_data)')
+  args = ap.parse_args()
+  main(args.imagefile, args.id, args.pages, args.rle)
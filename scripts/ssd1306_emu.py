@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+# SSD1306 controller emulator and bus timing model.
+#
+# Feeds a capture of the bytes the library sends to the display (e.g. a
+# logic analyzer's protocol decoder export) through a model
+# of the SSD1306 command set and display RAM, then reports how long the
+# traffic takes on the wire at a given bus clock, and the resulting frame
+# rate. The final display RAM can be dumped for comparison against the
+# library's getBuffer() contents.
+#
+# Capture format, one bus transaction per line, bytes in hex:
+#   I2C: the bytes following the address byte, starting with the control
+#        byte, e.g. "00 22 00 07 21 00 7F" (commands) or "40 FF 00 ..."
+#        (data). Control bytes with the continuation bit set (0x80, 0xC0)
+#        each apply to the one byte after them, as the SSD1306 reads them.
+#        A leading "S" token (from some analyzer exports) and an
+#        address token of the form "3C:" are ignored.
+#   SPI: "C" or "D" (state of the D/C pin) followed by the bytes sent
+#        while chip select was low, e.g. "C AE D5 80" or "D FF 00 ...".
+# Blank lines mark the end of a frame; without them the whole capture is
+# treated as one frame. Lines starting with '#' are ignored.
+#
+# --self-test checks the control byte parsing against known transactions.
+
+import argparse
+import sys
+
+# Number of argument bytes following each multi-byte command
+ARGS = {
+  0x20: 1, # Memory addressing mode
+  0x21: 2, # Column address
+  0x22: 2, # Page address
+  0x26: 6, # Right horizontal scroll setup
+  0x27: 6, # Left horizontal scroll setup
+  0x29: 5, # Vertical and right horizontal scroll setup
+  0x2A: 5, # Vertical and left horizontal scroll setup
+  0x81: 1, # Contrast
+  0x8D: 1, # Charge pump
+  0xA3: 2, # Vertical scroll area
+  0xA8: 1, # Multiplex ratio
+  0xD3: 1, # Display offset
+  0xD5: 1, # Clock divide
+  0xD9: 1, # Precharge
+  0xDA: 1, # COM pins
+  0xDB: 1, # VCOMH deselect level
+}
+
+class SSD1306:
+  def __init__(self):
+    self.ram        = bytearray(8 * 128)
+    self.mode       = 2 # Page addressing is the power-on default
+    self.col1, self.col2   = 0, 127
+    self.page1, self.page2 = 0, 7
+    self.col, self.page    = 0, 0
+    self.start_line = 0
+    self.offset     = 0
+    self.invert     = False
+    self.on         = False
+    self.segremap   = False
+    self.comscandec = False
+    self.mux        = 64
+    self.contrast   = 0x7F
+    self.scroll     = None   # Last scroll setup (command + args)
+    self.scrolling  = False
+    self.pending    = None   # Multi-byte command awaiting arguments
+    self.args       = []
+
+  def command(self, b):
+    if self.pending is not None:
+      self.args.append(b)
+      if len(self.args) == ARGS[self.pending]:
+        self.finish(self.pending, self.args)
+        self.pending = None
+      return
+    if b in ARGS:
+      self.pending, self.args = b, []
+    elif b <= 0x0F:            # Lower column start (page mode)
+      self.col = (self.col & 0xF0) | b
+    elif b <= 0x1F:            # Upper column start (page mode)
+      self.col = (self.col & 0x0F) | ((b & 0x0F) << 4)
+    elif 0x40 <= b <= 0x7F:
+      self.start_line = b & 0x3F
+    elif b in (0xA0, 0xA1):
+      self.segremap = b & 1
+    elif b in (0xA6, 0xA7):
+      self.invert = b & 1
+    elif b in (0xAE, 0xAF):
+      self.on = b & 1
+    elif 0xB0 <= b <= 0xB7:    # Page start (page mode)
+      self.page = b & 7
+    elif b in (0xC0, 0xC8):
+      self.comscandec = b == 0xC8
+    elif b == 0x2E:
+      self.scrolling = False
+    elif b == 0x2F:
+      self.scrolling = True
+
+  def finish(self, cmd, args):
+    if cmd == 0x20:
+      self.mode = args[0] & 3
+    elif cmd == 0x21:
+      self.col1, self.col2 = args[0] & 0x7F, args[1] & 0x7F
+      self.col = self.col1
+    elif cmd == 0x22:
+      self.page1, self.page2 = args[0] & 7, args[1] & 7
+      self.page = self.page1
+    elif cmd == 0x81:
+      self.contrast = args[0]
+    elif cmd == 0xA8:
+      self.mux = (args[0] & 0x3F) + 1
+    elif cmd == 0xD3:
+      self.offset = args[0] & 0x3F
+    elif cmd in (0x26, 0x27, 0x29, 0x2A):
+      self.scroll = [cmd] + list(args)
+
+  def data(self, b):
+    self.ram[self.page * 128 + self.col] = b
+    if self.mode == 0:         # Horizontal: column first, then page
+      if self.col >= self.col2:
+        self.col  = self.col1
+        self.page = self.page1 if self.page >= self.page2 else self.page + 1
+      else:
+        self.col += 1
+    elif self.mode == 1:       # Vertical: page first, then column
+      if self.page >= self.page2:
+        self.page = self.page1
+        self.col  = self.col1 if self.col >= self.col2 else self.col + 1
+      else:
+        self.page += 1
+    else:                      # Page: column wraps within the page
+      self.col = (self.col + 1) & 0x7F
+
+  def pixel(self, x, y):
+    # Pixel as seen on the glass, applying start line and invert
+    line = (y + self.start_line) % 64
+    return bool(self.ram[(line >> 3) * 128 + x] & (1 << (line & 7))) != \
+      bool(self.invert)
+
+def i2c_time(nbytes, clk):
+  # START + address byte + data bytes (9 clocks each w/ACK) + STOP, plus
+  # bus free time between transactions (from I2C spec for the speed mode)
+  t_buf = 4.7e-6 if clk <= 100000 else (1.3e-6 if clk <= 400000 else 0.5e-6)
+  return (1 + 9 * (nbytes + 1) + 1) / clk + t_buf
+
+def spi_time(nbytes, clk, gap):
+  return nbytes * (8 / clk + gap)
+
+def parse(fn):
+  frames, cur = [], []
+  with open(fn) as f:
+    for line in f:
+      line = line.strip()
+      if line.startswith('#'):
+        continue
+      if not line:
+        if cur:
+          frames.append(cur)
+          cur = []
+        continue
+      kind, tokens = None, line.replace(',', ' ').split()
+      if tokens[0] in ('S', 's'):
+        tokens = tokens[1:]
+      if tokens and tokens[0].endswith(':'):
+        tokens = tokens[1:]
+      if tokens and tokens[0] in ('C', 'D', 'c', 'd'):
+        kind, tokens = tokens[0].upper(), tokens[1:]
+      cur.append((kind, bytes(int(t, 16) for t in tokens)))
+  if cur:
+    frames.append(cur)
+  return frames
+
+def rechunk(txn, chunk):
+  # Split an I2C data transaction into chunks of at most 'chunk' bytes
+  # including the control byte, as the library does per setWireChunkSize()
+  if len(txn) <= chunk or txn[0] != 0x40:
+    return [txn]
+  out = []
+  for i in range(1, len(txn), chunk - 1):
+    out.append(bytes([txn[0]]) + txn[i:i + chunk - 1])
+  return out
+
+def feed_i2c(dev, txn):
+  # Take in one I2C transaction (control byte first), returning counts of
+  # command and data bytes. While a control byte has Co = 1, it's paired
+  # with the single byte after it; the first with Co = 0 makes the rest
+  # of the transaction one stream of commands or data, per its D/C bit.
+  ncmd = ndata = 0
+  i = 0
+  while i < len(txn):
+    ctrl = txn[i]
+    i   += 1
+    body = txn[i:i + 1] if ctrl & 0x80 else txn[i:]
+    i   += len(body)
+    for b in body:
+      if ctrl & 0x40:
+        dev.data(b)
+        ndata += 1
+      else:
+        dev.command(b)
+        ncmd += 1
+  return ncmd, ndata
+
+def self_test():
+  # Known transactions, in each control byte form, through feed_i2c():
+  # the window is pages 1-2, columns 4-5, filled in horizontal mode
+  dev = SSD1306()
+  checks = [
+    # Co = 0, all commands: addressing mode and window
+    ('00 20 00 22 01 02 21 04 05', (8, 0)),
+    # Co = 1 pairs (invert on, two data bytes), then Co = 0 data to the end
+    ('80 A7 C0 11 C0 22 40 33 44', (1, 4)),
+    # Co = 1 pairs only: data wrapping back to the window start, then
+    # invert off
+    ('C0 55 80 A6', (1, 1)),
+  ]
+  ok = True
+  for txn, want in checks:
+    got = feed_i2c(dev, bytes.fromhex(txn))
+    if got != want:
+      print('FAIL: {} gave {} command/data bytes, want {}'.format(
+        txn, got, want))
+      ok = False
+  ram = [dev.ram[p * 128 + c] for p in (1, 2) for c in (4, 5)]
+  if ram != [0x55, 0x22, 0x33, 0x44] or dev.invert:
+    print('FAIL: RAM {} invert {}'.format(
+      ' '.join('{:02X}'.format(b) for b in ram), dev.invert))
+    ok = False
+  print('Self-test ' + ('OK' if ok else 'FAILED'))
+  return ok
+
+def main():
+  ap = argparse.ArgumentParser(description='SSD1306 emulator/bus timing model')
+  ap.add_argument('capture', nargs='?',
+                  help='capture file (see header for format)')
+  ap.add_argument('--bus', choices=('i2c', 'spi'), default='i2c')
+  ap.add_argument('--clock', type=float, default=None,
+                  help='bus clock in Hz (default 400000 I2C, 8000000 SPI)')
+  ap.add_argument('--chunk', type=int, default=0,
+                  help='re-split I2C data transactions to this many bytes '
+                       '(e.g. 32 to model setWireChunkSize(32)); 0 = as '
+                       'captured')
+  ap.add_argument('--overhead-us', type=float, default=0.0,
+                  help='MCU software time per transaction, microseconds')
+  ap.add_argument('--gap-us', type=float, default=0.0,
+                  help='SPI idle time between bytes, microseconds')
+  ap.add_argument('--width', type=int, default=128)
+  ap.add_argument('--height', type=int, default=64)
+  ap.add_argument('--dump', help='write display RAM (width * height / 8 '
+                  'bytes, same layout as getBuffer()) to this file')
+  ap.add_argument('--ascii', action='store_true',
+                  help='print final screen contents as text')
+  ap.add_argument('--self-test', action='store_true',
+                  help='check the I2C control byte parsing and exit')
+  args = ap.parse_args()
+  if args.self_test:
+    sys.exit(0 if self_test() else 1)
+  if not args.capture:
+    ap.error('a capture file is required')
+
+  clk = args.clock or (400000 if args.bus == 'i2c' else 8000000)
+  dev = SSD1306()
+  times, ncmd, ndata, ntxn = [], 0, 0, 0
+  for frame in parse(args.capture):
+    t = 0.0
+    for kind, txn in frame:
+      if args.bus == 'i2c':
+        if not txn:
+          continue
+        pieces = rechunk(txn, args.chunk) if args.chunk else [txn]
+        for piece in pieces:
+          t    += i2c_time(len(piece), clk) + args.overhead_us * 1e-6
+          ntxn += 1
+        c, d = feed_i2c(dev, txn)
+        ncmd  += c
+        ndata += d
+      else:
+        t    += spi_time(len(txn), clk, args.gap_us * 1e-6)
+        t    += args.overhead_us * 1e-6
+        ntxn += 1
+        for b in txn:
+          if kind == 'D':
+            dev.data(b)
+          else:
+            dev.command(b)
+        if kind == 'D':
+          ndata += len(txn)
+        else:
+          ncmd += len(txn)
+    times.append(t)
+
+  total = sum(times)
+  print('Bus:            {} at {:.0f} Hz'.format(args.bus.upper(), clk))
+  print('Transactions:   {}'.format(ntxn))
+  print('Command bytes:  {}'.format(ncmd))
+  print('Data bytes:     {}'.format(ndata))
+  print('Wire time:      {:.3f} ms'.format(total * 1e3))
+  if times:
+    print('Frames:         {}'.format(len(times)))
+    print('Frame latency:  min {:.3f} / avg {:.3f} / max {:.3f} ms'.format(
+      min(times) * 1e3, total / len(times) * 1e3, max(times) * 1e3))
+    if total > 0:
+      print('Frame rate:     {:.1f} frames/sec'.format(len(times) / total))
+  if dev.scroll:
+    print('Scroll:         {} ({})'.format(
+      ' '.join('{:02X}'.format(b) for b in dev.scroll),
+      'active' if dev.scrolling else 'stopped'))
+  print('Display:        {}{}, start line {}'.format(
+    'on' if dev.on else 'off', ', inverted' if dev.invert else '',
+    dev.start_line))
+
+  if args.dump:
+    pages = (args.height + 7) // 8
+    with open(args.dump, 'wb') as f:
+      for page in range(pages):
+        f.write(dev.ram[page * 128:page * 128 + args.width])
+  if args.ascii:
+    for y in range(args.height):
+      print(''.join('#' if dev.pixel(x, y) else '.'
+                    for x in range(args.width)))
+
+if __name__ == '__main__':
+  main()
@@ -69,6 +69,77 @@ const uint8_t PROGMEM splash1_data[] = {
   B11111111,B11111111,B11111111,B11111111,B11111101,B01101011,B01011011,B11011011,B01101010,B11111101,B11000000,
 };
 
+#define splash1_pages  8
+
+// Page-major, 656 bytes
+const uint8_t PROGMEM splash1_page_data[] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0xF0,0xFC,0xFE,0xFF,
+  0xFF,0xFC,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x3C,0xFC,0xFC,
+  0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xF8,0xF8,0xF0,0xE0,0xFE,0xFF,0xFF,0xFF,0x1F,
+  0x3F,0xFF,0xFF,0xFF,0xFF,0xDF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x03,0x07,0x0F,0x1F,0x3F,0xBF,0xFF,0xFF,0xFD,0xF9,0x71,0x73,0x37,0xFF,
+  0xFC,0x7C,0x7E,0xE7,0xE7,0xE7,0xE7,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x3F,
+  0x3F,0x1F,0x0F,0x0F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xC0,0xF8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFC,0xFE,
+  0x7F,0x3F,0xFF,0xFF,0xFC,0xF8,0xFB,0xFF,0xFF,0xFF,0xFF,0xFD,0xF1,0x01,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x07,0x0F,0x0F,0x07,0x07,0x07,0x03,0x03,0x01,0x01,
+  0x80,0x80,0x80,0x80,0x80,0x83,0x07,0x07,0x0F,0x1F,0x3F,0x3F,0x7F,0x7F,0x3F,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,
+  0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF0,0xF0,0xF0,0x70,0x70,
+  0x70,0x70,0xF0,0xF0,0xF0,0xE0,0x00,0xE0,0xF0,0xF0,0xF0,0x70,0x70,0x70,0x60,0xFF,
+  0xFF,0xFF,0xFF,0x00,0xE0,0xF0,0xF0,0xF0,0x70,0x70,0x70,0x70,0xF0,0xF0,0xF0,0xE0,
+  0x00,0xFF,0xFF,0xFF,0xFF,0x73,0x73,0x73,0x00,0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xF0,
+  0xF0,0xF0,0x00,0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0x00,
+  0xF3,0xF3,0xF3,0xF3,0x00,0xFC,0xFC,0xFC,0xFC,0x70,0x70,0x70,0xF9,0xFD,0xFD,0xFD,
+  0x8C,0x8C,0x8C,0x8C,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,
+  0x80,0xFF,0xFF,0xFF,0xFF,0x00,0xF9,0xFD,0xFD,0xFD,0x8C,0x8C,0x8C,0x8C,0xFF,0xFF,
+  0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x01,
+  0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0x80,0xFF,0xFF,0xFF,
+  0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0xF9,0xFB,
+  0xFB,0xFB,0xFB,0xFB,0xF9,0xF9,0xFB,0xFB,0xFB,0xFB,0xF8,0xF9,0xFB,0xFB,0xFB,0xFB,
+  0xFB,0xFB,0xF9,0xF9,0xFB,0xFB,0xFB,0xF8,0xF9,0xFB,0xFB,0xFB,0xFB,0xFB,0xF9,0xF9,
+  0xFB,0xFB,0xFB,0xFB,0x08,0xFB,0x0B,0xDB,0xBB,0x08,0xF8,0x08,0xE8,0xEB,0x1B,0xFB,
+  0x0B,0xF8,0xF8,0x08,0xF8,0xD8,0xA8,0xA9,0x6B,0xFB,0xEB,0x0B,0xEB,0xF9,0x09,0xAB,
+  0xAB,0x5B,0xFB,0x08,0xFB,0x0B,0xAB,0xAB,0xF8,0xD9,0xAB,0xAB,0x6B,0xFB,0xFB,0xFB,
+};
+
+// Page-major, run-length encoded, 318 bytes (656 unpacked)
+const uint8_t PROGMEM splash1_rle_data[] = {
+  0xA8,0x00,0x08,0x80,0xE0,0xF0,0xFC,0xFE,0xFF,0xFF,0xFC,0xE0,0xB7,0x00,0x01,0x18,
+  0x3C,0x87,0xFC,0x80,0xF8,0x02,0xF0,0xE0,0xFE,0x81,0xFF,0x01,0x1F,0x3F,0x82,0xFF,
+  0x00,0xDF,0x84,0xC0,0x81,0x80,0xB0,0x00,0x11,0x01,0x03,0x07,0x0F,0x1F,0x3F,0xBF,
+  0xFF,0xFF,0xFD,0xF9,0x71,0x73,0x37,0xFF,0xFC,0x7C,0x7E,0x82,0xE7,0x00,0xF7,0x84,
+  0xFF,0x06,0x7F,0x3F,0x3F,0x1F,0x0F,0x0F,0x06,0xAE,0x00,0x02,0xC0,0xF8,0xFE,0x83,
+  0xFF,0x09,0xFD,0xFC,0xFE,0x7F,0x3F,0xFF,0xFF,0xFC,0xF8,0xFB,0x82,0xFF,0x02,0xFD,
+  0xF1,0x01,0xAD,0x00,0x82,0x80,0x83,0x00,0x02,0x07,0x0F,0x0F,0x81,0x07,0x80,0x03,
+  0x80,0x01,0x83,0x80,0x09,0x83,0x07,0x07,0x0F,0x1F,0x3F,0x3F,0x7F,0x7F,0x3F,0x8D,
+  0x00,0x82,0x80,0x86,0x00,0x00,0xE0,0x81,0xF0,0x82,0x70,0x81,0xF0,0x02,0xE0,0x00,
+  0xE0,0x81,0xF0,0x81,0x70,0x00,0x60,0x82,0xFF,0x01,0x00,0xE0,0x81,0xF0,0x82,0x70,
+  0x81,0xF0,0x01,0xE0,0x00,0x82,0xFF,0x81,0x73,0x00,0x00,0x82,0xF0,0x80,0xE0,0x81,
+  0xF0,0x00,0x00,0x82,0xF0,0x82,0x00,0x82,0xF0,0x00,0x00,0x82,0xF3,0x00,0x00,0x82,
+  0xFC,0x81,0x70,0x00,0xF9,0x81,0xFD,0x82,0x8C,0x82,0xFF,0x00,0x00,0x82,0xFF,0x82,
+  0x80,0x82,0xFF,0x01,0x00,0xF9,0x81,0xFD,0x82,0x8C,0x82,0xFF,0x00,0x00,0x82,0xFF,
+  0x82,0x00,0x82,0xFF,0x00,0x01,0x83,0x00,0x82,0xFF,0x82,0x80,0x82,0xFF,0x00,0x00,
+  0x82,0xFF,0x00,0x00,0x82,0xFF,0x81,0x80,0x00,0xF9,0x83,0xFB,0x80,0xF9,0x82,0xFB,
+  0x01,0xF8,0xF9,0x84,0xFB,0x80,0xF9,0x81,0xFB,0x01,0xF8,0xF9,0x83,0xFB,0x80,0xF9,
+  0x82,0xFB,0x28,0x08,0xFB,0x0B,0xDB,0xBB,0x08,0xF8,0x08,0xE8,0xEB,0x1B,0xFB,0x0B,
+  0xF8,0xF8,0x08,0xF8,0xD8,0xA8,0xA9,0x6B,0xFB,0xEB,0x0B,0xEB,0xF9,0x09,0xAB,0xAB,
+  0x5B,0xFB,0x08,0xFB,0x0B,0xAB,0xAB,0xF8,0xD9,0xAB,0xAB,0x6B,0x81,0xFB,
+};
+
 #define splash2_width  115
 #define splash2_height 32
 
@@ -106,3 +177,61 @@ const uint8_t PROGMEM splash2_data[] = {
   B00000000,B00000000,B00001111,B00000000,B01111111,B11111111,B11111111,B11111111,B11111110,B10100101,B10101101,B10011101,B10001101,B00011001,B11100000,
   B00000000,B00000000,B00000110,B00000000,B01111111,B11111111,B11111111,B11111111,B11111110,B10110101,B10101101,B11101101,B10110101,B01111110,B11100000,
 };
+
+#define splash2_pages  4
+
+// Page-major, 460 bytes
+const uint8_t PROGMEM splash2_page_data[] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0xF0,0xFC,
+  0xFE,0xFF,0xFF,0xF8,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0x0F,0x1F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xBE,0x3C,0x3F,
+  0x7F,0xFF,0x87,0xC7,0xFF,0x7F,0x7F,0x7F,0xF8,0xF8,0xF8,0xF8,0xF8,0xF0,0xF0,0xF0,
+  0xE0,0xE0,0x60,0x00,0xE0,0xF0,0xF0,0xF0,0x70,0x70,0x70,0x70,0xF0,0xF0,0xF0,0xE0,
+  0x00,0xE0,0xF0,0xF0,0xF0,0x70,0x70,0x70,0x60,0xFF,0xFF,0xFF,0xFF,0x00,0xE0,0xF0,
+  0xF0,0xF0,0x70,0x70,0x70,0x70,0xF0,0xF0,0xF0,0xE0,0x00,0xFF,0xFF,0xFF,0xFF,0x73,
+  0x73,0x73,0x00,0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xF0,0xF0,0xF0,0x00,0xF0,0xF0,0xF0,
+  0xF0,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0x00,0xF3,0xF3,0xF3,0xF3,0x00,0xFC,
+  0xFC,0xFC,0xFC,0x70,0x70,0x70,0x00,0x00,0x00,0x00,0x80,0xF1,0xF9,0xFF,0xFF,0xFF,
+  0xFF,0xE7,0xE3,0xF3,0xFF,0xFF,0xE3,0xC6,0xFE,0xFE,0xFE,0xFF,0xEF,0x0F,0x0F,0x07,
+  0x07,0x03,0x01,0x01,0x00,0x00,0x00,0xF9,0xFD,0xFD,0xFD,0x8C,0x8C,0x8C,0x8C,0xFF,
+  0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0x80,0xFF,0xFF,0xFF,0xFF,
+  0x00,0xF9,0xFD,0xFD,0xFD,0x8C,0x8C,0x8C,0x8C,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
+  0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,
+  0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
+  0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0x00,0x00,0x00,0x1C,0x1F,0x1F,0x0F,
+  0x0F,0x0F,0x07,0x07,0x07,0x03,0x01,0x01,0x07,0x0F,0x1F,0x1F,0x3F,0x7F,0xFF,0xFF,
+  0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xFB,0xFB,0xFB,0xFB,0xFB,
+  0xF9,0xF9,0xFB,0xFB,0xFB,0xFB,0xF8,0xF9,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xF9,0xF9,
+  0xFB,0xFB,0xFB,0xF8,0xF9,0xFB,0xFB,0xFB,0xFB,0xFB,0xF9,0xF9,0xFB,0xFB,0xFB,0xFB,
+  0x08,0xFB,0x0B,0xDB,0xBB,0x08,0xF8,0x08,0xE8,0xEB,0x1B,0xFB,0x0B,0xF8,0xF8,0x08,
+  0xF8,0xD8,0xA8,0xA9,0x6B,0xFB,0xEB,0x0B,0xEB,0xF9,0x09,0xAB,0xAB,0x5B,0xFB,0x08,
+  0xFB,0x0B,0xAB,0xAB,0xF8,0xD9,0xAB,0xAB,0x6B,0xFB,0xFB,0xFB,
+};
+
+// Page-major, run-length encoded, 294 bytes (460 unpacked)
+const uint8_t PROGMEM splash2_rle_data[] = {
+  0x8A,0x00,0x08,0x80,0xE0,0xF0,0xFC,0xFE,0xFF,0xFF,0xF8,0xC0,0x9F,0x00,0x82,0x80,
+  0x8D,0x00,0x84,0x80,0x96,0x00,0x82,0x80,0x86,0x00,0x03,0x06,0x0F,0x1F,0x7F,0x82,
+  0xFF,0x80,0xFE,0x07,0xBE,0x3C,0x3F,0x7F,0xFF,0x87,0xC7,0xFF,0x81,0x7F,0x83,0xF8,
+  0x81,0xF0,0x80,0xE0,0x02,0x60,0x00,0xE0,0x81,0xF0,0x82,0x70,0x81,0xF0,0x02,0xE0,
+  0x00,0xE0,0x81,0xF0,0x81,0x70,0x00,0x60,0x82,0xFF,0x01,0x00,0xE0,0x81,0xF0,0x82,
+  0x70,0x81,0xF0,0x01,0xE0,0x00,0x82,0xFF,0x81,0x73,0x00,0x00,0x82,0xF0,0x80,0xE0,
+  0x81,0xF0,0x00,0x00,0x82,0xF0,0x82,0x00,0x82,0xF0,0x00,0x00,0x82,0xF3,0x00,0x00,
+  0x82,0xFC,0x81,0x70,0x82,0x00,0x02,0x80,0xF1,0xF9,0x82,0xFF,0x06,0xE7,0xE3,0xF3,
+  0xFF,0xFF,0xE3,0xC6,0x81,0xFE,0x08,0xFF,0xEF,0x0F,0x0F,0x07,0x07,0x03,0x01,0x01,
+  0x81,0x00,0x00,0xF9,0x81,0xFD,0x82,0x8C,0x82,0xFF,0x00,0x00,0x82,0xFF,0x82,0x80,
+  0x82,0xFF,0x01,0x00,0xF9,0x81,0xFD,0x82,0x8C,0x82,0xFF,0x00,0x00,0x82,0xFF,0x82,
+  0x00,0x82,0xFF,0x00,0x01,0x83,0x00,0x82,0xFF,0x82,0x80,0x82,0xFF,0x00,0x00,0x82,
+  0xFF,0x00,0x00,0x82,0xFF,0x81,0x80,0x81,0x00,0x02,0x1C,0x1F,0x1F,0x81,0x0F,0x81,
+  0x07,0x0B,0x03,0x01,0x01,0x07,0x0F,0x1F,0x1F,0x3F,0x7F,0xFF,0xFF,0x7F,0x87,0x00,
+  0x00,0xF9,0x83,0xFB,0x80,0xF9,0x82,0xFB,0x01,0xF8,0xF9,0x84,0xFB,0x80,0xF9,0x81,
+  0xFB,0x01,0xF8,0xF9,0x83,0xFB,0x80,0xF9,0x82,0xFB,0x28,0x08,0xFB,0x0B,0xDB,0xBB,
+  0x08,0xF8,0x08,0xE8,0xEB,0x1B,0xFB,0x0B,0xF8,0xF8,0x08,0xF8,0xD8,0xA8,0xA9,0x6B,
+  0xFB,0xEB,0x0B,0xEB,0xF9,0x09,0xAB,0xAB,0x5B,0xFB,0x08,0xFB,0x0B,0xAB,0xAB,0xF8,
+  0xD9,0xAB,0xAB,0x6B,0x81,0xFB,
+};
@@ -0,0 +1,103 @@
+// Test animation: a 60x24 spinner, 12 frames. Made with
+//   make_anim.py --id spin <frames>
+// plus, as references for the player, frames 0, 5 and 11 on their own
+// in page-major form from make_splash.py --pages.
+
+#define spin_width  60
+#define spin_height 24
+#define spin_frames 12
+
+// 12 frames, 58 spans, 629 bytes (2160 unpacked)
+const uint8_t PROGMEM spin_anim[] = {
+  0x3C,0x03,0x0C,0x00,0x05,0x00,0xF8,0x0C,0x04,0x0C,0xF8,0xB5,0x00,0x04,0x01,0x03,
+  0x02,0x03,0x01,0x96,0x00,0x8A,0x30,0x90,0x00,0x85,0xF0,0xB3,0x00,0x00,0x01,0x05,
+  0x04,0xF0,0x08,0xF8,0x0C,0xF8,0x01,0x01,0x05,0x04,0x01,0x03,0x01,0x03,0x01,0x01,
+  0x1F,0x0B,0x04,0x10,0x50,0x70,0xF0,0xB0,0x84,0x30,0x02,0x00,0x0B,0x82,0xF0,0x81,
+  0x00,0x82,0xF0,0x02,0x23,0x05,0x80,0x01,0x02,0x03,0x02,0x06,0xFF,0x00,0x02,0x03,
+  0x02,0x80,0xB8,0x38,0x01,0x00,0x05,0x04,0x02,0x03,0x02,0x01,0x02,0x01,0x1E,0x06,
+  0x05,0x20,0x50,0x80,0xC0,0xC0,0x80,0x02,0x04,0x0B,0x82,0xF0,0x81,0x00,0x82,0xF0,
+  0x02,0x20,0x08,0x07,0x01,0x07,0x1E,0x39,0x21,0x03,0x02,0x06,0xFF,0x00,0x00,0x05,
+  0x04,0x88,0x0C,0xA0,0x60,0xE0,0x01,0x00,0x05,0x04,0x03,0x01,0x00,0x00,0x03,0x01,
+  0x1E,0x04,0x03,0xE0,0x80,0xE0,0x80,0x02,0x08,0x0B,0x82,0xF0,0x81,0x00,0x82,0xF0,
+  0x02,0x1E,0x07,0x80,0xFF,0x04,0x01,0x07,0x1E,0x38,0x20,0xFF,0x00,0x00,0x06,0x05,
+  0x08,0xC4,0x94,0xAC,0x24,0x80,0x01,0x00,0x05,0x00,0x01,0x82,0x02,0x01,0x1B,0x05,
+  0x04,0x80,0xC0,0xF0,0x88,0xE0,0x02,0x0C,0x14,0x82,0xF0,0x81,0x00,0x82,0xF0,0x08,
+  0x00,0x10,0x3C,0x1E,0x07,0x03,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x06,0x05,0xF8,0x84,
+  0x94,0xAC,0x38,0x80,0x01,0x00,0x05,0x00,0x01,0x82,0x02,0x01,0x16,0x0A,0x80,0x80,
+  0x07,0xC0,0x40,0x60,0xA0,0xF0,0xE0,0x60,0x10,0x02,0x10,0x0D,0x82,0xF0,0x08,0x03,
+  0x01,0x01,0xF0,0xE0,0xCC,0xEE,0x07,0x03,0xFF,0x00,0x00,0x06,0x05,0x78,0xB4,0x08,
+  0x00,0xE0,0xD8,0x01,0x00,0x06,0x05,0x01,0x03,0x00,0x00,0x03,0x01,0x01,0x13,0x0B,
+  0x81,0x18,0x80,0x98,0x05,0xD8,0x58,0x78,0x38,0x28,0x08,0x02,0x14,0x0B,0x03,0xF3,
+  0xF1,0xF1,0xF0,0x81,0x00,0x82,0xF0,0xFF,0x00,0x00,0x06,0x05,0x04,0xF4,0xE8,0x10,
+  0x28,0xD8,0x00,0x13,0x05,0x04,0x40,0x60,0xC0,0xC0,0x80,0x01,0x01,0x05,0x82,0x02,
+  0x00,0x01,0x01,0x13,0x0C,0x81,0x18,0x80,0x19,0x80,0x1B,0x04,0x1E,0x16,0x14,0x00,
+  0x10,0x02,0x18,0x0B,0x82,0xF0,0x81,0x00,0x82,0xF0,0xFF,0x00,0x00,0x06,0x05,0x04,
+  0xDC,0xE0,0x10,0x28,0xD8,0x00,0x13,0x0A,0x09,0x40,0x60,0xC0,0xC0,0x84,0x1E,0x7C,
+  0xF0,0xC0,0x80,0x01,0x01,0x05,0x82,0x02,0x00,0x01,0x01,0x16,0x08,0x80,0x01,0x80,
+  0x03,0x03,0x06,0x0D,0x03,0x06,0x02,0x1C,0x0B,0x82,0xF0,0x81,0x00,0x82,0xF0,0xFF,
+  0x00,0x01,0x05,0x82,0x60,0x00,0x20,0x00,0x17,0x08,0x07,0x04,0x1E,0x7C,0xF0,0xC0,
+  0xFE,0xFE,0x80,0x01,0x04,0x02,0x80,0x01,0x01,0x1B,0x04,0x03,0x03,0x0F,0x01,0x17,
+  0x02,0x20,0x0B,0x82,0xF0,0x81,0x00,0x82,0xF0,0xFF,0x00,0x01,0x0B,0x0A,0xB0,0x40,
+  0xB8,0x44,0xF8,0x00,0xF8,0x0C,0x04,0x0C,0xF8,0x00,0x1C,0x08,0x07,0x7E,0xFE,0x80,
+  0x00,0xC0,0x70,0x1C,0x04,0x01,0x01,0x0B,0x0A,0x01,0x02,0x01,0x03,0x00,0x00,0x01,
+  0x03,0x02,0x03,0x01,0x01,0x1D,0x04,0x03,0x0F,0x03,0x07,0x01,0x02,0x24,0x0B,0x82,
+  0xF0,0x81,0x00,0x82,0xF0,0xFF,0x00,0x07,0x05,0x04,0xF0,0x08,0xF8,0x0C,0xF8,0x00,
+  0x20,0x08,0x07,0xC0,0x70,0x1C,0x04,0x00,0x80,0xC0,0x80,0x01,0x07,0x05,0x04,0x01,
+  0x03,0x01,0x03,0x01,0x01,0x1E,0x08,0x07,0x2C,0x1F,0x0D,0x0C,0x06,0x03,0x03,0x01,
+  0x02,0x28,0x0B,0x82,0xF0,0x81,0x00,0x82,0xF0,0xFF,0x00,0x01,0x09,0x08,0xF0,0x08,
+  0xF8,0x0C,0xF8,0x00,0x08,0x04,0xFC,0x00,0x25,0x03,0x02,0x80,0xC0,0x80,0x01,0x01,
+  0x09,0x04,0x01,0x03,0x01,0x03,0x01,0x81,0x00,0x00,0x03,0x01,0x1D,0x0D,0x08,0x10,
+  0x00,0x28,0x3C,0x3C,0x36,0x33,0x33,0x31,0x82,0x30,0x02,0x00,0x07,0x85,0xF0,0x02,
+  0x2C,0x07,0x85,0xF0,0xFF,
+};
+#define spin_f00_pages  3
+
+// Page-major, 180 bytes
+const uint8_t PROGMEM spin_f00_page_data[] = {
+  0x00,0xF8,0x0C,0x04,0x0C,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x02,
+  0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x30,0x30,0x30,0x30,
+  0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,
+};
+#define spin_f05_pages  3
+
+// Page-major, 180 bytes
+const uint8_t PROGMEM spin_f05_page_data[] = {
+  0x78,0x44,0x24,0x24,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x02,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x80,0xC0,0x40,0x60,0x20,0x30,0x10,0x18,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0xF1,0xF1,0xF0,
+  0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,
+};
+#define spin_f11_pages  3
+
+// Page-major, 180 bytes
+const uint8_t PROGMEM spin_f11_page_data[] = {
+  0x00,0x08,0x04,0xFC,0x00,0x00,0x00,0x08,0x04,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+  0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x30,0x18,0x0C,0x0C,0x06,0x03,
+  0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,
+};
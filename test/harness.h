@@ -0,0 +1,217 @@
+// Shared pieces of the host tests: a CHECK() macro, an emulated SSD1306
+// that rebuilds display RAM from the bytes the library sends, and pin
+// recording for bitbang SPI.
+//
+// Each test is a plain program that runs its checks and returns nonzero
+// if any failed, so CTest (or a shell loop) can run it with no framework.
+
+#ifndef _SSD1306_TEST_HARNESS_H_
+#define _SSD1306_TEST_HARNESS_H_
+
+#include <Adafruit_SSD1306.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+static int failures = 0; ///< CHECK()s failed so far
+
+/*!
+    @brief  Count and report a failed condition, then carry on, so one
+            run shows every failure rather than the first.
+*/
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if(!(cond)) {                                                     \
+      if(++failures <= 20)                                            \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                 \
+  } while(0)
+
+/*!
+    @brief  Print the outcome and give the process exit status.
+    @return 0 if every CHECK() passed, 1 otherwise.
+*/
+static inline int report(void) {
+  if(failures) printf("FAILED: %d check(s)\n", failures);
+  else printf("OK\n");
+  return failures ? 1 : 0;
+}
+
+/*!
+    @brief  SSD1306 display RAM and the part of the command set that
+            affects where data lands: horizontal addressing with column
+            and page windows (0x21, 0x22). Commands that take arguments
+            have them skipped, the rest are counted and ignored. RAM
+            starts as 0xAA so bytes never sent stand out.
+*/
+class SSD1306_Emu {
+public:
+  uint8_t ram[8 * 128];   ///< Display RAM, page-major like the library's buffer
+  unsigned long commands; ///< Command bytes received, arguments included
+  unsigned long data;     ///< Data bytes received
+  unsigned long txns;     ///< I2C transmissions or SPI D/C runs taken in
+  bool written[8 * 128];  ///< RAM bytes stored to, until cleared by a test
+
+  SSD1306_Emu(void) { reset(); }
+
+  void reset(void) {
+    memset(ram, 0xAA, sizeof(ram));
+    memset(written, 0, sizeof(written));
+    col1 = col = page1 = page = 0;
+    col2 = 127;
+    page2 = 7;
+    cmd = argc = argn = 0;
+    commands = data = txns = 0;
+  }
+
+  void command(uint8_t c) {
+    commands++;
+    if(argn) { // Argument of a command in progress
+      args[argc++] = c;
+      if(argc < argn) return;
+      if(cmd == 0x21) {
+        col1 = col = args[0] & 0x7F;
+        col2 = args[1] & 0x7F;
+      } else if(cmd == 0x22) {
+        page1 = page = args[0] & 7;
+        page2 = args[1] & 7;
+      }
+      argn = 0;
+      return;
+    }
+    cmd  = c;
+    argc = 0;
+    argn = argCount(c);
+  }
+
+  void write(uint8_t d) {
+    data++;
+    ram[page * 128 + col]     = d;
+    written[page * 128 + col] = true;
+    if(col == col2) {
+      col = col1;
+      page = (page == page2) ? page1 : (page + 1) & 7;
+    } else {
+      col = (col + 1) & 0x7F;
+    }
+  }
+
+  /*!
+      @brief  Take in, and clear, the I2C traffic so far, optionally only
+              that for one address.
+  */
+  void feed(TwoWire &wire, int addr = -1) {
+    for(size_t t = 0; t < wire.txns.size(); t++) {
+      const WireTransmission &x = wire.txns[t];
+      if((addr >= 0) && (x.addr != addr)) continue;
+      feed(x.bytes.data(), x.bytes.size());
+    }
+    wire.txns.clear();
+  }
+
+  /*!
+      @brief  Take in one I2C transmission: control byte(s) and payload.
+  */
+  void feed(const uint8_t *b, size_t n) {
+    txns++;
+    for(size_t i = 0; i < n;) {
+      uint8_t ctrl = b[i++];
+      bool    isData = ctrl & 0x40;
+      if(ctrl & 0x80) { // Continuation bit: one byte, then another control
+        if(i < n) isData ? write(b[i]) : command(b[i]);
+        i++;
+      } else { // Rest of the transmission is all one kind
+        for(; i < n; i++) isData ? write(b[i]) : command(b[i]);
+      }
+    }
+  }
+
+  /*!
+      @brief  Take in, and clear, SPI bytes tagged with the D/C state.
+  */
+  void feed(std::vector<SPIByte> &log) {
+    bool last = false;
+    for(size_t i = 0; i < log.size(); i++) {
+      if(!i || (log[i].data != last)) txns++;
+      last = log[i].data;
+      last ? write(log[i].value) : command(log[i].value);
+    }
+    log.clear();
+  }
+
+  void feed(SPIClass &spi) { feed(spi.log); }
+
+  /*!
+      @brief  Compare RAM with a library buffer of the same panel.
+      @return true if every byte of the panel's pages matches.
+  */
+  bool matches(const uint8_t *buf, uint8_t w, uint8_t h) const {
+    for(uint8_t p = 0; p < (h + 7) / 8; p++) {
+      if(memcmp(&ram[p * 128], &buf[p * w], w)) return false;
+    }
+    return true;
+  }
+
+  bool matches(Adafruit_SSD1306 &d, uint8_t w = 128, uint8_t h = 64) const {
+    return matches(d.getBufferReadOnly(), w, h);
+  }
+
+private:
+  static uint8_t argCount(uint8_t c) {
+    switch(c) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+    case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+    }
+    return 0;
+  }
+
+  uint8_t cmd, args[6], argc, argn;
+  uint8_t col1, col2, col, page1, page2, page;
+};
+
+/// A digitalWrite() seen through pinHook
+struct PinEvent {
+  uint8_t pin, val;
+};
+
+static std::vector<PinEvent> pinEvents; ///< Filled by recordPin()
+
+/*!
+    @brief  pinHook that appends every digitalWrite() to pinEvents.
+*/
+static inline void recordPin(uint8_t pin, uint8_t val) {
+  PinEvent e = { pin, val };
+  pinEvents.push_back(e);
+}
+
+/*!
+    @brief  Decode bitbang SPI from recorded pin activity: MOSI sampled
+            on each rising edge of the clock, MSB first, tagged with the
+            D/C pin state at the byte's last bit.
+*/
+static inline std::vector<SPIByte> decodeSoftSPI(
+  const std::vector<PinEvent> &ev, uint8_t mosi, uint8_t clk, uint8_t dc) {
+  std::vector<SPIByte> out;
+  uint8_t level[ARDUINO_STUB_PINS] = { 0 }, bits = 0, shift = 0;
+  for(size_t i = 0; i < ev.size(); i++) {
+    bool rising = (ev[i].pin == clk) && !level[clk] && ev[i].val;
+    level[ev[i].pin] = ev[i].val;
+    if(!rising) continue;
+    shift = (shift << 1) | level[mosi];
+    if(++bits == 8) {
+      SPIByte b = { level[dc] == HIGH, shift };
+      out.push_back(b);
+      bits = shift = 0;
+    }
+  }
+  return out;
+}
+
+#endif // _SSD1306_TEST_HARNESS_H_
@@ -0,0 +1,46 @@
+// Runs an example sketch on the host: setup(), then loop() until the
+// sketch has asked for a given amount of delay() time (60 s by default,
+// or the first argument in milliseconds), or for at most LOOP_MAX passes
+// for a sketch whose loop() never delays. delay() doesn't sleep, so this
+// replays the sketch's drawing at full speed; the sketch's own setup()
+// may never return (several end in an animation), which the delay budget
+// also ends. Afterwards the I2C traffic is fed to an emulated display to
+// check it shows what the sketch's buffer holds, and the time spent and
+// bytes sent are reported. The sketch must name its display `display`.
+
+#include "harness.h"
+
+void setup(void);
+void loop(void);
+extern Adafruit_SSD1306 display;
+
+#define LOOP_MAX 100000 ///< loop() passes, if the delay budget isn't used up
+
+int main(int argc, char *argv[]) {
+  unsigned long start, elapsed, bytes = 0, txns = Wire.txns.size();
+  delayLimit = (argc > 1) ? strtoul(argv[1], NULL, 10) : 60000;
+
+  start = micros();
+  try {
+    setup();
+    for(unsigned long n = 0; n < LOOP_MAX; n++) loop();
+  } catch(StubDelayLimit &) {
+  }
+  elapsed = micros() - start - delayTotal * 1000;
+
+  txns = Wire.txns.size();
+  for(size_t i = 0; i < Wire.txns.size(); i++) bytes += Wire.txns[i].bytes.size();
+  printf("\nRan %lu ms of sketch time in %lu us: %lu I2C transmissions, "
+         "%lu bytes, %lu SPI bytes\n", delayTotal, elapsed, txns, bytes,
+         (unsigned long)SPI.log.size());
+
+  if(txns) { // An I2C sketch: the panel must end up showing the buffer
+    int16_t     w = display.width(), h = display.height();
+    SSD1306_Emu emu;
+    if(display.getRotation() & 1) std::swap(w, h);
+    emu.feed(Wire);
+    CHECK(emu.matches(display, w, h));
+  }
+  CHECK(Wire.overruns == 0);
+  return report();
+}
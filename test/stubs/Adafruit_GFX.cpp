@@ -0,0 +1,420 @@
+// Drawing algorithms of the host Adafruit_GFX stand-in, following the
+// real library's so the display class sees the same calls.
+
+#include "Adafruit_GFX.h"
+
+#define _swap_int16_t(a, b) \
+  {                         \
+    int16_t t = a;          \
+    a = b;                  \
+    b = t;                  \
+  }
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+  _width    = WIDTH;
+  _height   = HEIGHT;
+  rotation  = 0;
+  cursor_y  = cursor_x = 0;
+  textsize  = 1;
+  textcolor = textbgcolor = 0xFFFF;
+  wrap      = true;
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint16_t color) {
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if(steep) {
+    _swap_int16_t(x0, y0);
+    _swap_int16_t(x1, y1);
+  }
+  if(x0 > x1) {
+    _swap_int16_t(x0, x1);
+    _swap_int16_t(y0, y1);
+  }
+
+  int16_t dx = x1 - x0, dy = abs(y1 - y0), err = dx / 2, ystep;
+  ystep = (y0 < y1) ? 1 : -1;
+
+  for(; x0 <= x1; x0++) {
+    if(steep) {
+      writePixel(y0, x0, color);
+    } else {
+      writePixel(x0, y0, color);
+    }
+    err -= dy;
+    if(err < 0) {
+      y0  += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+  drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h,
+                                  uint16_t color) {
+  drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  drawFastHLine(x, y, w, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  startWrite();
+  writeLine(x, y, x, y + h - 1, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  startWrite();
+  writeLine(x, y, x + w - 1, y, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  startWrite();
+  for(int16_t i = x; i < x + w; i++) {
+    writeFastVLine(i, y, h, color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color) {
+  if(x0 == x1) {
+    if(y0 > y1) _swap_int16_t(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+  } else if(y0 == y1) {
+    if(x0 > x1) _swap_int16_t(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+  } else {
+    startWrite();
+    writeLine(x0, y0, x1, y1, color);
+    endWrite();
+  }
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
+                              uint16_t color) {
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+  startWrite();
+  writePixel(x0, y0 + r, color);
+  writePixel(x0, y0 - r, color);
+  writePixel(x0 + r, y0, color);
+  writePixel(x0 - r, y0, color);
+
+  while(x < y) {
+    if(f >= 0) {
+      y--;
+      ddF_y += 2;
+      f     += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f     += ddF_x;
+
+    writePixel(x0 + x, y0 + y, color);
+    writePixel(x0 - x, y0 + y, color);
+    writePixel(x0 + x, y0 - y, color);
+    writePixel(x0 - x, y0 - y, color);
+    writePixel(x0 + y, y0 + x, color);
+    writePixel(x0 - y, y0 + x, color);
+    writePixel(x0 + y, y0 - x, color);
+    writePixel(x0 - y, y0 - x, color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                    uint8_t cornername, uint16_t color) {
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+  while(x < y) {
+    if(f >= 0) {
+      y--;
+      ddF_y += 2;
+      f     += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f     += ddF_x;
+    if(cornername & 0x4) {
+      writePixel(x0 + x, y0 + y, color);
+      writePixel(x0 + y, y0 + x, color);
+    }
+    if(cornername & 0x2) {
+      writePixel(x0 + x, y0 - y, color);
+      writePixel(x0 + y, y0 - x, color);
+    }
+    if(cornername & 0x8) {
+      writePixel(x0 - y, y0 + x, color);
+      writePixel(x0 - x, y0 + y, color);
+    }
+    if(cornername & 0x1) {
+      writePixel(x0 - y, y0 - x, color);
+      writePixel(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
+                              uint16_t color) {
+  startWrite();
+  writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                    uint8_t corners, int16_t delta,
+                                    uint16_t color) {
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  int16_t px = x, py = y;
+
+  delta++; // Avoid some +1's in the loop
+
+  while(x < y) {
+    if(f >= 0) {
+      y--;
+      ddF_y += 2;
+      f     += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f     += ddF_x;
+    // These checks avoid double-drawing certain lines, important
+    // for the SSD1306 library which has an INVERT drawing mode.
+    if(x < (y + 1)) {
+      if(corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if(corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if(y != py) {
+      if(corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if(corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 int16_t r, uint16_t color) {
+  int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
+  if(r > max_radius) r = max_radius;
+  startWrite();
+  writeFastHLine(x + r, y, w - 2 * r, color);         // Top
+  writeFastHLine(x + r, y + h - 1, w - 2 * r, color); // Bottom
+  writeFastVLine(x, y + r, h - 2 * r, color);         // Left
+  writeFastVLine(x + w - 1, y + r, h - 2 * r, color); // Right
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 int16_t r, uint16_t color) {
+  int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
+  if(r > max_radius) r = max_radius;
+  startWrite();
+  writeFillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                int16_t y1, int16_t x2, int16_t y2,
+                                uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                int16_t y1, int16_t x2, int16_t y2,
+                                uint16_t color) {
+  int16_t a, b, y, last;
+
+  // Sort coordinates by Y order (y2 >= y1 >= y0)
+  if(y0 > y1) {
+    _swap_int16_t(y0, y1);
+    _swap_int16_t(x0, x1);
+  }
+  if(y1 > y2) {
+    _swap_int16_t(y2, y1);
+    _swap_int16_t(x2, x1);
+  }
+  if(y0 > y1) {
+    _swap_int16_t(y0, y1);
+    _swap_int16_t(x0, x1);
+  }
+
+  startWrite();
+  if(y0 == y2) { // All on same scanline
+    a = b = x0;
+    if(x1 < a) a = x1;
+    else if(x1 > b) b = x1;
+    if(x2 < a) a = x2;
+    else if(x2 > b) b = x2;
+    writeFastHLine(a, y0, b - a + 1, color);
+    endWrite();
+    return;
+  }
+
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+          dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+
+  // Upper part of triangle, the scanline y1 included only if it's flat
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for(y = y0; y <= last; y++) {
+    a   = x0 + sa / dy01;
+    b   = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if(a > b) _swap_int16_t(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+
+  // Lower part of triangle
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for(; y <= y2; y++) {
+    a   = x1 + sa / dy12;
+    b   = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if(a > b) _swap_int16_t(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                              int16_t w, int16_t h, uint16_t color) {
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  uint8_t b = 0;
+
+  startWrite();
+  for(int16_t j = 0; j < h; j++, y++) {
+    for(int16_t i = 0; i < w; i++) {
+      if(i & 7) b <<= 1;
+      else b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      if(b & 0x80) writePixel(x + i, y, color);
+    }
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                              int16_t w, int16_t h, uint16_t color,
+                              uint16_t bg) {
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  uint8_t b = 0;
+
+  startWrite();
+  for(int16_t j = 0; j < h; j++, y++) {
+    for(int16_t i = 0; i < w; i++) {
+      if(i & 7) b <<= 1;
+      else b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      writePixel(x + i, y, (b & 0x80) ? color : bg);
+    }
+  }
+  endWrite();
+}
+
+// Column i (0-4) of the stand-in glyph for c: a box whose inside comes
+// from the character code, blank for space and control characters.
+static uint8_t glyphColumn(unsigned char c, uint8_t i) {
+  if(c <= ' ') return 0;
+  if((i == 0) || (i == 4)) return 0x7F;
+  return 0x41 | ((c * (i + 3)) & 0x3E);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size) {
+  if((x >= _width) ||            // Clip right
+     (y >= _height) ||           // Clip bottom
+     ((x + 6 * size - 1) < 0) || // Clip left
+     ((y + 8 * size - 1) < 0))   // Clip top
+    return;
+
+  startWrite();
+  for(int8_t i = 0; i < 5; i++) { // Char bitmap = 5 columns
+    uint8_t line = glyphColumn(c, i);
+    for(int8_t j = 0; j < 8; j++, line >>= 1) {
+      if(line & 1) {
+        if(size == 1) writePixel(x + i, y + j, color);
+        else writeFillRect(x + i * size, y + j * size, size, size, color);
+      } else if(bg != color) {
+        if(size == 1) writePixel(x + i, y + j, bg);
+        else writeFillRect(x + i * size, y + j * size, size, size, bg);
+      }
+    }
+  }
+  if(bg != color) { // If opaque, draw vertical line for last column
+    if(size == 1) writeFastVLine(x + 5, y, 8, bg);
+    else writeFillRect(x + 5 * size, y, size, 8 * size, bg);
+  }
+  endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if(c == '\n') {
+    cursor_x  = 0;
+    cursor_y += textsize * 8;
+  } else if(c != '\r') {
+    if(wrap && ((cursor_x + textsize * 6) > _width)) {
+      cursor_x  = 0;
+      cursor_y += textsize * 8;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    cursor_x += textsize * 6;
+  }
+  return 1;
+}
+
+void Adafruit_GFX::setRotation(uint8_t x) {
+  rotation = (x & 3);
+  switch(rotation) {
+  case 0:
+  case 2:
+    _width  = WIDTH;
+    _height = HEIGHT;
+    break;
+  case 1:
+  case 3:
+    _width  = HEIGHT;
+    _height = WIDTH;
+    break;
+  }
+}
@@ -0,0 +1,100 @@
+// Host stand-in for Adafruit_GFX, with the same class layout, virtual
+// functions and drawing algorithms as the real library (lines, circles,
+// triangles, rounded rectangles, bitmaps, classic 6x8 text), so drawing
+// reaches the display class through the same calls and in about the
+// same numbers as on a board. The only shortcut is the font: glyphs are
+// a pattern made from the character code rather than the real glcdfont.
+
+#ifndef _ADAFRUIT_GFX_H
+#define _ADAFRUIT_GFX_H
+
+#include "Arduino.h"
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite(void) {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color);
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color);
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         uint16_t color);
+  virtual void endWrite(void) {}
+
+  virtual void setRotation(uint8_t r);
+  virtual void invertDisplay(bool i) { (void)i; }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                        uint16_t color);
+  virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+                        uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+                        int16_t delta, uint16_t color);
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
+                    int16_t y2, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
+                    int16_t y2, uint16_t color);
+  void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+                     int16_t radius, uint16_t color);
+  void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+                     int16_t radius, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size);
+  void setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) {
+    textcolor   = c;
+    textbgcolor = bg;
+  }
+  void setTextSize(uint8_t s) { textsize = (s > 0) ? s : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+  void cp437(bool x = true) { (void)x; }
+
+  using Print::write;
+  virtual size_t write(uint8_t c);
+
+  int16_t width(void) const { return _width; }
+  int16_t height(void) const { return _height; }
+  uint8_t getRotation(void) const { return rotation; }
+  int16_t getCursorX(void) const { return cursor_x; }
+  int16_t getCursorY(void) const { return cursor_y; }
+
+protected:
+  int16_t  WIDTH;       ///< This is the 'raw' display width - never changes
+  int16_t  HEIGHT;      ///< This is the 'raw' display height - never changes
+  int16_t  _width;      ///< Display width as modified by current rotation
+  int16_t  _height;     ///< Display height as modified by current rotation
+  int16_t  cursor_x;    ///< x location to start print()ing text
+  int16_t  cursor_y;    ///< y location to start print()ing text
+  uint16_t textcolor;   ///< 16-bit background color for print()
+  uint16_t textbgcolor; ///< 16-bit text color for print()
+  uint8_t  textsize;    ///< Desired magnification of text to print()
+  uint8_t  rotation;    ///< Display rotation (0 thru 3)
+  bool     wrap;        ///< If set, 'wrap' text at right edge of display
+};
+
+#endif // _ADAFRUIT_GFX_H
@@ -0,0 +1,111 @@
+// Host stand-in for the Arduino core's pins, timing, random numbers and
+// the Serial, Wire and SPI objects.
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "SPI.h"
+#include <chrono>
+
+HardwareSerial Serial;
+TwoWire        Wire;
+SPIClass       SPI;
+
+void (*pinHook)(uint8_t pin, uint8_t val) = NULL;
+unsigned long delayLimit = 0;
+unsigned long delayTotal = 0;
+
+static uint8_t pinState[ARDUINO_STUB_PINS];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if(pin >= ARDUINO_STUB_PINS) return;
+  pinState[pin] = val ? HIGH : LOW;
+  if(pinHook) (*pinHook)(pin, pinState[pin]);
+}
+
+int digitalRead(uint8_t pin) {
+  return (pin < ARDUINO_STUB_PINS) ? pinState[pin] : LOW;
+}
+
+unsigned long   portWrites[ARDUINO_STUB_PINS];
+static StubPort ports[ARDUINO_STUB_PINS / 8] = {
+  { 0 }, { 1 }, { 2 }, { 3 }, { 4 }, { 5 }, { 6 }, { 7 }
+};
+
+uint8_t digitalPinToPort(uint8_t pin) {
+  return (pin < ARDUINO_STUB_PINS) ? pin / 8 : 0;
+}
+
+uint8_t digitalPinToBitMask(uint8_t pin) {
+  return (pin < ARDUINO_STUB_PINS) ? 1 << (pin & 7) : 0;
+}
+
+StubPort *portOutputRegister(uint8_t port) {
+  return &ports[port];
+}
+
+uint8_t StubPort::read(void) const {
+  uint8_t val = 0;
+  for(uint8_t i = 0; i < 8; i++) val |= pinState[port * 8 + i] << i;
+  return val;
+}
+
+StubPort &StubPort::operator|=(uint8_t mask) {
+  set(read() | mask, mask);
+  return *this;
+}
+
+StubPort &StubPort::operator&=(uint8_t mask) {
+  set(read() & mask, ~mask);
+  return *this;
+}
+
+// Store val, which differs from the port's state only in bits of mask
+void StubPort::set(uint8_t val, uint8_t mask) {
+  uint8_t old = read();
+  for(uint8_t i = 0; i < 8; i++) {
+    uint8_t pin = port * 8 + i;
+    if(mask & (1 << i)) portWrites[pin]++;
+    if((old ^ val) & (1 << i)) digitalWrite(pin, (val >> i) & 1);
+  }
+}
+
+static std::chrono::steady_clock::time_point start =
+  std::chrono::steady_clock::now();
+
+unsigned long micros(void) {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start).count() + delayTotal * 1000;
+}
+
+unsigned long millis(void) {
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms) {
+  delayTotal += ms;
+  if(delayLimit && (delayTotal >= delayLimit)) throw StubDelayLimit();
+}
+
+void delayMicroseconds(unsigned int us) {
+  (void)us;
+}
+
+void yield(void) {
+}
+
+long random(long howbig) {
+  return howbig ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig) {
+  return (howsmall < howbig) ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if(seed) srand(seed);
+}
@@ -0,0 +1,188 @@
+// Host stand-in for the Arduino core, just enough of it to build the
+// library and its example sketches on a desktop for tests and benchmarks.
+//
+// Pins are an array of states plus an optional hook, so tests can decode
+// bitbang SPI or check pin waveforms; stand-in port registers map onto the
+// same pins, eight to a port. Time is the host's monotonic clock;
+// delay() doesn't sleep, it only advances a virtual offset added to
+// millis() and micros(), so example sketches replay at full speed.
+
+#ifndef _ARDUINO_STUB_H_
+#define _ARDUINO_STUB_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include "binary.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define pgm_read_pointer(addr) (*(void * const *)(addr))
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define ARDUINO_STUB_PINS 64 ///< Pins 0 to 63 exist, others are ignored
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+/*!
+    @brief  Called after every digitalWrite() when set, with the pin and
+            its new state. Used to record or decode pin activity.
+*/
+extern void (*pinHook)(uint8_t pin, uint8_t val);
+
+/*!
+    @brief  When nonzero, delay() throws StubDelayLimit once this many
+            milliseconds of delays have passed in total. Lets a test run
+            a sketch whose setup() never returns.
+*/
+extern unsigned long delayLimit;
+
+/*!
+    @brief  Total milliseconds passed to delay() so far.
+*/
+extern unsigned long delayTotal;
+
+/// Thrown by delay() when delayLimit is reached
+struct StubDelayLimit {};
+
+/*!
+    @brief  Stand-in for an 8-bit output port register covering pins
+            port*8 to port*8+7. Reads see the pins' states; each
+            read-modify-write goes through digitalWrite() for the pins it
+            changes, so pinHook sees port writes like any other, and is
+            counted in portWrites for every pin its mask selects.
+*/
+class StubPort {
+public:
+  uint8_t port; ///< Port number
+  uint8_t read(void) const;
+  StubPort &operator|=(uint8_t mask);
+  StubPort &operator&=(uint8_t mask);
+private:
+  void set(uint8_t val, uint8_t mask);
+};
+
+/*!
+    @brief  Port read-modify-writes aimed at each pin so far, e.g. two per
+            bit for a bitbang SPI clock (high, then low).
+*/
+extern unsigned long portWrites[ARDUINO_STUB_PINS];
+
+uint8_t   digitalPinToPort(uint8_t pin);
+uint8_t   digitalPinToBitMask(uint8_t pin);
+StubPort *portOutputRegister(uint8_t port);
+
+// A build with HAVE_PORTREG defined (no host has port registers of its
+// own) uses the stand-ins for the library's direct port access.
+#ifdef HAVE_PORTREG
+typedef StubPort PortReg;  ///< Port register type, see Adafruit_SSD1306.h
+typedef uint8_t  PortMask; ///< Port bit mask type
+#endif
+
+/// Output half of the Arduino Print class
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while(size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *str) {
+    return str ? write((const uint8_t *)str, strlen(str)) : 0;
+  }
+
+  size_t print(const __FlashStringHelper *s) {
+    return write(reinterpret_cast<const char *>(s));
+  }
+  size_t print(const char s[]) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(long n, int base = DEC) {
+    if((base == DEC) && (n < 0)) return print('-') + print((unsigned long)-n);
+    return print((unsigned long)n, base);
+  }
+  size_t print(unsigned long n, int base = DEC) {
+    char buf[8 * sizeof(long) + 1], *s = &buf[sizeof(buf) - 1];
+    *s = 0;
+    if(base < 2) base = 10;
+    do {
+      char c = n % base;
+      n /= base;
+      *--s = c < 10 ? c + '0' : c + 'A' - 10;
+    } while(n);
+    return write(s);
+  }
+  size_t print(double n, int digits = 2) {
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", digits, n);
+    return write(buf);
+  }
+
+  size_t println(void) { return write("\r\n"); }
+  template <typename T> size_t println(T x) { return print(x) + println(); }
+  template <typename T> size_t println(T x, int base) {
+    return print(x, base) + println();
+  }
+};
+
+/// Serial port, written to stdout
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // _ARDUINO_STUB_H_
@@ -0,0 +1,74 @@
+// Host stand-in for the Arduino SPI library. Each byte sent is logged
+// with the state of the D/C pin at the time (see dcPin), which is all an
+// SSD1306 needs to tell commands from display data.
+
+#ifndef _SPI_STUB_H_
+#define _SPI_STUB_H_
+
+#include "Arduino.h"
+#include <vector>
+
+#define SPI_HAS_TRANSACTION
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+class SPISettings {
+public:
+  SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+    : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+  uint32_t clock;
+  uint8_t  bitOrder, dataMode;
+};
+
+/// One byte out of SPI, and whether D/C was high (data) while it was sent
+struct SPIByte {
+  bool    data;
+  uint8_t value;
+};
+
+class SPIClass {
+public:
+  std::vector<SPIByte> log;    ///< Bytes sent, oldest first
+  int8_t   dcPin;              ///< Pin read for SPIByte::data, -1 for always data
+  unsigned long transfers;     ///< transfer() calls, single or block
+  unsigned long transactions;  ///< beginTransaction() calls
+  bool     inTransaction;      ///< Between beginTransaction() and end
+  SPISettings settings;        ///< From the last beginTransaction()
+
+  SPIClass() : dcPin(-1), transfers(0), transactions(0), inTransaction(false) {}
+  void begin(void) {}
+  void beginTransaction(SPISettings s) {
+    settings      = s;
+    inTransaction = true;
+    transactions++;
+  }
+  void endTransaction(void) { inTransaction = false; }
+  uint8_t transfer(uint8_t d) {
+    transfers++;
+    record(d);
+    return 0;
+  }
+  // Like the AVR core, received bytes (here 0xFF) replace those sent
+  void transfer(void *buf, size_t n) {
+    transfers++;
+    uint8_t *p = (uint8_t *)buf;
+    while(n--) {
+      record(*p);
+      *p++ = 0xFF;
+    }
+  }
+
+private:
+  void record(uint8_t d) {
+    SPIByte b = { (dcPin < 0) || (digitalRead(dcPin) == HIGH), d };
+    log.push_back(b);
+  }
+};
+
+extern SPIClass SPI;
+
+#endif // _SPI_STUB_H_
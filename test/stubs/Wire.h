@@ -0,0 +1,59 @@
+// Host stand-in for the Arduino Wire library. Every transmission is kept,
+// with its address, until a test takes it, so traffic can be checked or
+// fed to an emulated display.
+
+#ifndef _WIRE_STUB_H_
+#define _WIRE_STUB_H_
+
+#include "Arduino.h"
+#include <vector>
+
+#define BUFFER_LENGTH 32 ///< Transmission size of the classic AVR Wire lib
+
+/// One I2C transmission as it appeared on the bus
+struct WireTransmission {
+  uint8_t              addr;  ///< 7-bit device address
+  uint32_t             clock; ///< Bus clock (Hz) when it was sent
+  std::vector<uint8_t> bytes; ///< Bytes following the address
+};
+
+class TwoWire {
+public:
+  std::vector<WireTransmission> txns; ///< Finished transmissions, oldest first
+  uint32_t clock;                     ///< Last setClock() value
+  unsigned long clockCalls;           ///< setClock() calls so far
+  unsigned long overruns;             ///< Writes beyond BUFFER_LENGTH
+
+  TwoWire() : clock(100000), clockCalls(0), overruns(0) {}
+  void begin(void) {}
+  void setClock(uint32_t hz) {
+    clock = hz;
+    clockCalls++;
+  }
+  void beginTransmission(uint8_t addr) {
+    cur.addr  = addr;
+    cur.clock = clock;
+    cur.bytes.clear();
+  }
+  size_t write(uint8_t b) {
+    if(cur.bytes.size() >= BUFFER_LENGTH) overruns++;
+    cur.bytes.push_back(b);
+    return 1;
+  }
+  size_t write(const uint8_t *b, size_t n) {
+    for(size_t i = 0; i < n; i++) write(b[i]);
+    return n;
+  }
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    txns.push_back(cur);
+    return 0;
+  }
+
+private:
+  WireTransmission cur;
+};
+
+extern TwoWire Wire;
+
+#endif // _WIRE_STUB_H_
@@ -0,0 +1,2 @@
+// Stand-in for avr-libc's util/delay.h, which the library includes on
+// every architecture it doesn't recognize. Nothing in it is used.
@@ -0,0 +1,49 @@
+// Animation player: at several positions (some clipped) and in each diff
+// mode, the buffer after each frame matches that frame drawn on its own,
+// nextAnimationFrame() counts through and wraps, and display() after
+// each frame keeps the panel matching the buffer.
+
+#include "harness.h"
+#include "data/spin.h"
+
+int main(void) {
+  const int16_t  pos[][2] = { { 10, 2 }, { -20, -1 }, { 100, 6 }, { 0, 0 } };
+  const uint8_t *ref[]    = { spin_f00_page_data, spin_f05_page_data,
+                              spin_f11_page_data };
+  const uint16_t refFrame[] = { 0, 5, 11 };
+
+  for(uint8_t q = 0; q < 4; q++) {
+    for(uint8_t mode = SSD1306_DIFF_NONE; mode <= SSD1306_DIFF_CHECKSUM;
+        mode++) {
+      Adafruit_SSD1306  a(128, 64, &Wire), b(128, 64, &Wire);
+      SSD1306_Emu       emu;
+      SSD1306_Animation anim;
+      int16_t           x = pos[q][0], page = pos[q][1];
+      CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                    SSD1306_SPLASH_NONE));
+      CHECK(b.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                    SSD1306_SPLASH_NONE));
+      CHECK(a.setDiffMode(mode));
+      Wire.txns.clear();
+      a.startAnimation(anim, spin_anim, x, page);
+      CHECK(anim.frames == spin_frames);
+      a.display();
+      emu.feed(Wire);
+
+      for(int step = 0; step < 30; step++) {
+        uint16_t f = anim.frame;
+        for(uint8_t k = 0; k < 3; k++) {
+          if(refFrame[k] != f) continue;
+          b.fillScreen(SSD1306_BLACK);
+          b.drawPageImage(x, page, ref[k], spin_width, spin_f00_pages);
+          CHECK(!memcmp(a.getBufferReadOnly(), b.getBufferReadOnly(), 1024));
+        }
+        CHECK(emu.matches(a));
+        CHECK(a.nextAnimationFrame(anim) == (f + 1) % spin_frames);
+        a.display();
+        emu.feed(Wire);
+      }
+    }
+  }
+  return report();
+}
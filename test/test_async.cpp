@@ -0,0 +1,195 @@
+// displayAsync() through a transport that completes a few busy() polls
+// after each write(), with and without double buffering. With a double
+// buffer the panel must end up showing the buffer as it was when the
+// frame was started, however the buffer has been drawn on since.
+//
+// Then through one that completes each write() on a timer thread, as a
+// DMA interrupt would: the callback must come once per frame, in order,
+// only after the transport has finished the frame's last write, and
+// isBusy() must be true exactly until then.
+
+#include "harness.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Commands go to the panel at once, data only when the write completes
+class PolledTransport : public Adafruit_SSD1306_Transport {
+public:
+  SSD1306_Emu         *emu;
+  std::vector<uint8_t> pending;
+  int                  polls;
+  long                 writes;
+
+  PolledTransport(SSD1306_Emu *e) : emu(e), polls(0), writes(0) {}
+  boolean write(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+                uint16_t len) {
+    if(polls) return false;
+    for(uint8_t i = 0; i < cmdLen; i++) emu->command(cmd[i]);
+    pending.assign(data, data + len);
+    polls = 1 + rand() % 3;
+    writes++;
+    return true;
+  }
+  boolean busy(void) {
+    if(polls && !--polls) {
+      for(size_t i = 0; i < pending.size(); i++) emu->write(pending[i]);
+    }
+    return polls != 0;
+  }
+};
+
+static int frames;
+static void frameDone(Adafruit_SSD1306 *) { frames++; }
+
+// Bytes reach the panel from a timer thread some time after write()
+class TimerTransport : public Adafruit_SSD1306_Transport {
+public:
+  SSD1306_Emu      *emu;
+  std::thread       timer;
+  std::atomic<bool> done;
+  bool              inWrite;
+  long              writes;
+
+  TimerTransport(SSD1306_Emu *e) : emu(e), done(true), inWrite(false),
+    writes(0) {}
+  ~TimerTransport() { while(busy()); }
+  boolean write(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+                uint16_t len) {
+    if(busy()) return false;
+    inWrite = true;
+    done    = false;
+    writes++;
+    // Reads cmd and data only later, so they must still be intact then
+    timer = std::thread([=]() {
+      std::this_thread::sleep_for(std::chrono::microseconds(50 + len / 4));
+      for(uint8_t i = 0; i < cmdLen; i++) emu->command(cmd[i]);
+      for(uint16_t i = 0; i < len; i++) emu->write(data[i]);
+      done = true;
+    });
+    inWrite = false;
+    return true;
+  }
+  boolean busy(void) {
+    if(!done) return true;
+    if(timer.joinable()) timer.join();
+    return false;
+  }
+};
+
+struct Frame {
+  uint8_t buf[1024];
+};
+static TimerTransport    *timerT;
+static std::vector<Frame> timerExpect; // Buffer as each frame was started
+
+static void timerDone(Adafruit_SSD1306 *) {
+  CHECK(!timerT->inWrite);
+  CHECK(!timerT->busy());
+  CHECK((size_t)frames < timerExpect.size());
+  if((size_t)frames < timerExpect.size()) {
+    CHECK(!memcmp(timerExpect[frames].buf, timerT->emu->ram, 1024));
+  }
+  frames++;
+}
+
+int main(void) {
+  for(int dbl = 0; dbl < 2; dbl++) {
+    Adafruit_SSD1306 d(128, 64, &Wire);
+    SSD1306_Emu      emu;
+    PolledTransport  t(&emu);
+    uint8_t          expect[1024];
+    bool             haveExpect = false;
+    srand(3);
+    frames = 0;
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    emu.feed(Wire);
+    d.setTransport(&t);
+    d.setDisplayCallback(frameDone);
+    CHECK(d.setDoubleBuffer(dbl));
+
+    int started = 0;
+    for(int i = 0; i < 5000; i++) {
+      int16_t x = rand() % 160 - 16, y = rand() % 100 - 16,
+              l = rand() % 80 - 5;
+      uint16_t c = rand() % 3;
+      switch(rand() % 5) {
+      case 0: d.drawPixel(x, y, c); break;
+      case 1: d.drawFastHLine(x, y, l, c); break;
+      case 2: d.drawFastVLine(x, y, l, c); break;
+      case 3:
+        if(!d.isBusy() && haveExpect) {
+          CHECK(!memcmp(expect, emu.ram, sizeof(expect)));
+          haveExpect = false;
+        }
+        break;
+      case 4:
+        if(!d.isBusy()) { // Previous frame done, so the next write is new
+          long writes = t.writes;
+          CHECK(d.displayAsync());
+          if(t.writes != writes) started++; // Else there was nothing to send
+          if(dbl) {
+            memcpy(expect, d.getBufferReadOnly(), sizeof(expect));
+            haveExpect = true;
+          }
+        }
+        break;
+      }
+    }
+    while(d.isBusy());
+    d.display();
+    CHECK(emu.matches(d));
+    CHECK((frames >= started) && (frames <= started + 1));
+  }
+
+  for(int dbl = 0; dbl < 2; dbl++) {
+    Adafruit_SSD1306 d(128, 64, &Wire);
+    SSD1306_Emu      emu;
+    TimerTransport   t(&emu);
+    srand(4);
+    frames = 0;
+    timerT = &t;
+    timerExpect.clear();
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    emu.feed(Wire);
+    d.setTransport(&t);
+    d.setDisplayCallback(timerDone);
+    CHECK(d.setDoubleBuffer(dbl));
+
+    int started = 0;
+    for(long i = 0; (started < 200) && (i < 10000000); i++) {
+      bool busy = d.isBusy();
+      // Idle only once the callback has run; until then it hasn't
+      CHECK(frames == (busy ? started - 1 : started));
+      if(busy) std::this_thread::yield(); // Let the timer run, even on 1 CPU
+      if(busy && !dbl) continue; // Frame is sent from the buffer itself
+      int16_t x = rand() % 160 - 16, y = rand() % 100 - 16,
+              l = rand() % 80 - 5;
+      switch(rand() % 4) {
+      case 0: d.drawPixel(x, y, rand() % 3); break;
+      case 1: d.drawFastHLine(x, y, l, rand() % 3); break;
+      case 2: d.fillRect(x, y, l, l / 2, rand() % 3); break;
+      case 3: {
+        // The frame may finish, and even the next one too, at any point
+        // in here, so have the next frame's expected contents ready first
+        long  writes = t.writes;
+        Frame f;
+        memcpy(f.buf, d.getBufferReadOnly(), sizeof(f.buf));
+        timerExpect.push_back(f);
+        if(d.displayAsync() && (t.writes != writes)) started++;
+        else timerExpect.pop_back(); // Busy, or nothing to send
+        break;
+      }
+      }
+    }
+    CHECK(started == 200);
+    while(d.isBusy());
+    CHECK(frames == started);
+    Frame f;
+    memcpy(f.buf, d.getBufferReadOnly(), sizeof(f.buf));
+    timerExpect.push_back(f);
+    d.display();
+    CHECK(emu.matches(d));
+  }
+  return report();
+}
@@ -0,0 +1,73 @@
+// Page-strip mode: drawBands() with 1 to 3 pages per band, in every
+// rotation, must put the same image on the panel as drawing the scene
+// into a full buffer, and in full-buffer mode drawBands() draws it once.
+
+#include "harness.h"
+#include <splash.h>
+
+static uint8_t rot;
+static int     seed;
+
+// A scene using most kinds of drawing, the same each time it's called
+static void scene(Adafruit_SSD1306 *d) {
+  srand(seed);
+  d->setRotation(rot);
+  for(int i = 0; i < 40; i++) {
+    int16_t x = rand() % 150 - 10, y = rand() % 80 - 10,
+            w = rand() % 60 - 5, h = rand() % 50 - 5;
+    uint16_t c = rand() % 3;
+    switch(rand() % 7) {
+    case 0: d->drawPixel(x, y, c); break;
+    case 1: d->drawFastHLine(x, y, w, c); break;
+    case 2: d->drawFastVLine(x, y, h, c); break;
+    case 3: d->fillRect(x, y, w, h, c); break;
+    case 4: d->fillCircle(x, y, abs(w) / 3, c); break;
+    case 5:
+      d->blit(x, y, splash2_data, splash2_width, splash2_height, rand() % 5);
+      break;
+    case 6:
+      d->drawPageImage(x, y / 8, splash2_rle_data, splash2_width,
+                       splash2_pages, true);
+      break;
+    }
+  }
+  d->setCursor(3, 3);
+  d->setTextColor(SSD1306_WHITE);
+  d->print("Hello band");
+}
+
+int main(void) {
+  for(uint8_t band = 1; band <= 3; band++) {
+    for(rot = 0; rot < 4; rot++) {
+      for(seed = 1; seed < 20; seed++) {
+        Adafruit_SSD1306 ref(128, 64, &Wire), a(128, 64, &Wire);
+        SSD1306_Emu      emu;
+        CHECK(ref.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                        SSD1306_SPLASH_NONE));
+        CHECK(a.setBandHeight(band));
+        Wire.txns.clear();
+        CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+        emu.feed(Wire);
+        scene(&ref);
+        a.drawBands(scene);
+        emu.feed(Wire);
+        CHECK(emu.matches(ref));
+        a.display(); // No buffer to send, so nothing happens
+        CHECK(Wire.txns.empty());
+      }
+    }
+  }
+
+  Adafruit_SSD1306 a(128, 64, &Wire), ref(128, 64, &Wire);
+  CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  CHECK(ref.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  Wire.txns.clear();
+  rot  = 0;
+  seed = 3;
+  a.drawBands(scene);
+  ref.fillScreen(SSD1306_BLACK);
+  scene(&ref);
+  CHECK(!memcmp(a.getBufferReadOnly(), ref.getBufferReadOnly(), 1024));
+  Wire.txns.clear();
+  return report();
+}
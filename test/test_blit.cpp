@@ -0,0 +1,60 @@
+// blit() and blitMasked() with each raster op, in every rotation, at
+// positions that clip on any side, against pixel-at-a-time drawing.
+
+#include "harness.h"
+
+// Pixel (i, j) of a row-major bitmap, MSB first, rows padded to bytes
+static bool bit(const uint8_t *b, int16_t w, int16_t i, int16_t j) {
+  return (b[j * ((w + 7) / 8) + i / 8] >> (7 - (i & 7))) & 1;
+}
+
+int main(void) {
+  srand(12);
+  for(uint8_t h = 32; h <= 64; h += 32) {
+    Adafruit_SSD1306 a(128, h, &Wire), b(128, h, &Wire);
+    SSD1306_Emu      emu;
+    CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    CHECK(b.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    a.display();
+    emu.feed(Wire);
+
+    for(int f = 0; f < 4000; f++) {
+      uint8_t r = rand() & 3;
+      a.setRotation(r);
+      b.setRotation(r);
+      int16_t bw = rand() % 70 + 1, bh = rand() % 70 + 1,
+              x = rand() % (a.width() + bw + 20) - bw - 10,
+              y = rand() % (a.height() + bh + 20) - bh - 10;
+      std::vector<uint8_t> bm((bw + 7) / 8 * bh), mask(bm.size());
+      for(size_t i = 0; i < bm.size(); i++) {
+        bm[i]   = rand();
+        mask[i] = rand();
+      }
+      uint8_t rop = rand() % 6; // 5 for masked
+      if(rop == 5) a.blitMasked(x, y, bm.data(), mask.data(), bw, bh);
+      else a.blit(x, y, bm.data(), bw, bh, rop);
+
+      for(int16_t j = 0; j < bh; j++) {
+        for(int16_t i = 0; i < bw; i++) {
+          bool s = bit(bm.data(), bw, i, j), p = b.getPixel(x + i, y + j);
+          switch(rop) {
+          case SSD1306_ROP_COPY:  p = s; break;
+          case SSD1306_ROP_OR:    p = p || s; break;
+          case SSD1306_ROP_AND:   p = p && s; break;
+          case SSD1306_ROP_XOR:   p = p != s; break;
+          case SSD1306_ROP_CLEAR: p = p && !s; break;
+          default: if(bit(mask.data(), bw, i, j)) p = s; break;
+          }
+          b.drawPixel(x + i, y + j, p);
+        }
+      }
+      CHECK(!memcmp(a.getBufferReadOnly(), b.getBufferReadOnly(), 16 * h));
+      if(!(f % 10)) {
+        a.display();
+        emu.feed(Wire);
+        CHECK(emu.matches(a, 128, h));
+      }
+    }
+  }
+  return report();
+}
@@ -0,0 +1,80 @@
+// Diff modes: code that writes straight into getBuffer() must still get
+// a correct panel in each mode, and with the shadow copy or checksums a
+// getBuffer() call that changes nothing must send nothing. Areas changed
+// but not yet sent when a mode is selected must go out whatever is drawn
+// there next.
+
+#include "harness.h"
+
+int main(void) {
+  for(uint8_t mode = SSD1306_DIFF_NONE; mode <= SSD1306_DIFF_CHECKSUM; mode++) {
+    Adafruit_SSD1306 d(128, 64, &Wire);
+    SSD1306_Emu      emu;
+    srand(2);
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    for(int i = 0; i < 50; i++) d.drawPixel(rand() % 128, rand() % 64, 1);
+    CHECK(d.setDiffMode(mode));
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+
+    for(int i = 0; i < 3000; i++) {
+      int16_t x = rand() % 160 - 16, y = rand() % 100 - 16,
+              l = rand() % 80 - 5;
+      uint16_t c = rand() % 3;
+      switch(rand() % 5) {
+      case 0: d.drawPixel(x, y, c); break;
+      case 1: d.drawFastHLine(x, y, l, c); break;
+      case 2: { // Poke bytes directly, some to values they already have
+        uint8_t *b = d.getBuffer();
+        for(int k = rand() % 8; k > 0; k--) b[rand() % 1024] ^= 1 << (rand() % 8);
+        if(rand() % 2) b[rand() % 1024] = b[rand() % 1024];
+        break;
+      }
+      case 3: if(!(rand() % 20)) d.clearDisplay(); break;
+      case 4:
+        d.display();
+        emu.feed(Wire);
+        CHECK(emu.matches(d));
+        break;
+      }
+    }
+
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+    unsigned long before = emu.data;
+    d.getBuffer(); // Marks everything changed
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+    if(mode == SSD1306_DIFF_NONE) {
+      CHECK(emu.data - before == 1024);
+    } else {
+      CHECK(emu.data == before);
+      CHECK(d.getSkippedBytes() >= 1024);
+    }
+  }
+
+  // Drawn, not sent, then the diff mode selected: the panel still shows
+  // the previous frame there. Drawing the complement of the unsent frame
+  // must not be taken for unchanged.
+  for(uint8_t mode = SSD1306_DIFF_SHADOW; mode <= SSD1306_DIFF_CHECKSUM;
+    mode++) {
+    Adafruit_SSD1306 d(128, 64, &Wire);
+    SSD1306_Emu      emu;
+    srand(5);
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    d.display();
+    for(int i = 0; i < 40; i++) {
+      d.fillRect(rand() % 128, rand() % 64, rand() % 30, rand() % 20,
+                 SSD1306_INVERSE);
+    }
+    CHECK(d.setDiffMode(mode));
+    d.fillRect(0, 0, 128, 64, SSD1306_INVERSE);
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+  }
+  return report();
+}
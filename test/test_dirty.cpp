@@ -0,0 +1,45 @@
+// Dirty-region tracking: after any mix of drawing calls, in every
+// rotation, display() must leave the panel showing exactly the buffer,
+// and a display() with nothing drawn since must send no data.
+
+#include "harness.h"
+
+int main(void) {
+  srand(1);
+  for(uint8_t rot = 0; rot < 4; rot++) {
+    Adafruit_SSD1306 d(128, 64, &Wire);
+    SSD1306_Emu      emu;
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    d.setRotation(rot);
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+
+    for(int i = 0; i < 2000; i++) {
+      int16_t x = rand() % 160 - 16, y = rand() % 100 - 16,
+              l = rand() % 80 - 5;
+      uint16_t c = rand() % 3;
+      switch(rand() % 6) {
+      case 0: d.drawPixel(x, y, c); break;
+      case 1: d.drawFastHLine(x, y, l, c); break;
+      case 2: d.drawFastVLine(x, y, l, c); break;
+      case 3: if(!(rand() % 20)) d.clearDisplay(); break;
+      case 4: d.fillRect(x, y, l, rand() % 30, c); break;
+      case 5:
+        d.display();
+        emu.feed(Wire);
+        CHECK(emu.matches(d));
+        break;
+      }
+    }
+
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+    unsigned long before = emu.data;
+    d.display();
+    emu.feed(Wire);
+    CHECK(emu.data == before);
+  }
+  return report();
+}
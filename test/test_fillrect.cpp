@@ -0,0 +1,44 @@
+// Native fillRect() and fillScreen() must set the same pixels as drawing
+// them one at a time, in every rotation and color, with rectangles that
+// run off any edge. As in Adafruit_GFX, a zero or negative width or
+// height draws nothing.
+
+#include "harness.h"
+
+int main(void) {
+  srand(11);
+  for(uint8_t h = 32; h <= 64; h += 32) {
+    Adafruit_SSD1306 a(128, h, &Wire), b(128, h, &Wire);
+    SSD1306_Emu      emu;
+    CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    CHECK(b.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    a.display();
+    emu.feed(Wire);
+
+    for(int f = 0; f < 3000; f++) {
+      uint8_t r = rand() & 3;
+      a.setRotation(r);
+      b.setRotation(r);
+      int16_t x = rand() % 160 - 16, y = rand() % 160 - 16,
+              w = rand() % 100 - 20, hh = rand() % 80 - 20;
+      uint16_t c = rand() % 3;
+      if(f % 500 == 7) {
+        a.fillScreen(c);
+        for(int16_t j = 0; j < b.height(); j++) {
+          for(int16_t i = 0; i < b.width(); i++) b.drawPixel(i, j, c);
+        }
+      }
+      a.fillRect(x, y, w, hh, c);
+      for(int16_t j = y; j < y + hh; j++) {
+        for(int16_t i = x; i < x + w; i++) b.drawPixel(i, j, c);
+      }
+      CHECK(!memcmp(a.getBufferReadOnly(), b.getBufferReadOnly(), 16 * h));
+      if(!(f % 10)) {
+        a.display();
+        emu.feed(Wire);
+        CHECK(emu.matches(a, 128, h));
+      }
+    }
+  }
+  return report();
+}
@@ -0,0 +1,44 @@
+// Frame-rate governor: display() called far more often than the set
+// rate sends frames at that rate, counts the rest as coalesced, and the
+// panel ends up showing the buffer once flushed. Time here is the stub's
+// delay() clock, so the test takes no real time.
+
+#include "harness.h"
+
+int main(void) {
+  Adafruit_SSD1306 d(128, 64, &Wire);
+  SSD1306_Emu      emu;
+  srand(24);
+  CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  emu.feed(Wire);
+  d.setFrameRate(50); // 20 ms per frame
+
+  unsigned long calls = 0, frames = 0;
+  unsigned long end = millis() + 2500;
+  while(millis() < end) {
+    for(uint8_t m = 0; m < 4; m++) { // Several parts of a sketch drawing
+      d.fillRect(rand() % 128, rand() % 64, 8, 8, SSD1306_INVERSE);
+      d.display();
+      calls++;
+    }
+    frames += !Wire.txns.empty();
+    emu.feed(Wire);
+    delay(2);
+  }
+  CHECK(d.flushDisplay(true));
+  emu.feed(Wire);
+  CHECK(emu.matches(d));
+  CHECK(!d.flushDisplay(true)); // Nothing left to send
+
+  CHECK((d.getFrameRate() >= 45) && (d.getFrameRate() <= 50));
+  CHECK((frames >= 120) && (frames <= 126));
+  CHECK(d.getCoalescedCalls() >= calls - frames - 1);
+
+  // With the governor off, display() sends at once
+  d.setFrameRate(0);
+  d.fillRect(0, 0, 5, 5, SSD1306_INVERSE);
+  d.display();
+  emu.feed(Wire);
+  CHECK(emu.matches(d));
+  return report();
+}
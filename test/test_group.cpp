@@ -0,0 +1,90 @@
+// Adafruit_SSD1306_Group: two displays behind an I2C multiplexer, one
+// directly on the bus and one on SPI, updated together whole or a slice
+// at a time. Each panel must match its own buffer after every update,
+// the shared I2C bus must change clock once per update, and adding more
+// than SSD1306_GROUP_MAX displays must fail.
+
+#include "harness.h"
+#include <map>
+
+#define MUX_ADDR 0x70
+#define DC_PIN   9
+
+static std::map<int, SSD1306_Emu> panels; // By mux channel * 256 + address
+static int channel = -1;
+
+// Hand each I2C transmission to the panel it reached
+static void route(void) {
+  for(size_t t = 0; t < Wire.txns.size(); t++) {
+    const WireTransmission &x = Wire.txns[t];
+    if(x.addr == MUX_ADDR) {
+      channel = x.bytes[0];
+    } else {
+      int key = ((x.addr == 0x3C) ? channel : 9) * 256 + x.addr;
+      panels[key].feed(x.bytes.data(), x.bytes.size());
+    }
+  }
+  Wire.txns.clear();
+}
+
+static void selectChannel(uint8_t c) {
+  route();
+  Wire.beginTransmission(MUX_ADDR);
+  Wire.write(c);
+  Wire.endTransmission();
+}
+static void mux0(Adafruit_SSD1306 *) { selectChannel(0); }
+static void mux1(Adafruit_SSD1306 *) { selectChannel(1); }
+
+int main(void) {
+  Adafruit_SSD1306 a(128, 64, &Wire), b(128, 64, &Wire), c(128, 32, &Wire),
+                   s(128, 64, &SPI, DC_PIN, -1, 10), extra(128, 64, &Wire);
+  SSD1306_Emu      spanel;
+  srand(20);
+  SPI.dcPin = DC_PIN;
+  mux0(&a);
+  CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  mux1(&b);
+  CHECK(b.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  CHECK(c.begin(SSD1306_SWITCHCAPVCC, 0x3D));
+  CHECK(s.begin(SSD1306_SWITCHCAPVCC, 0));
+  route();
+  spanel.feed(SPI);
+
+  Adafruit_SSD1306_Group g;
+  CHECK(g.add(&a, mux0));
+  CHECK(g.add(&b, mux1));
+  CHECK(g.add(&c));
+  CHECK(g.add(&s));
+  CHECK(!g.add(&extra)); // SSD1306_GROUP_MAX is 4
+
+  for(int f = 0; f < 20; f++) {
+    a.fillCircle(rand() % 128, rand() % 64, rand() % 20, SSD1306_INVERSE);
+    b.fillRect(rand() % 128, rand() % 64, rand() % 40, rand() % 30,
+               SSD1306_INVERSE);
+    if(f & 1) {
+      c.drawLine(rand() % 128, rand() % 32, rand() % 128, rand() % 32,
+                 SSD1306_INVERSE);
+    }
+    s.fillRect(rand() % 128, rand() % 64, 1 + rand() % 40, 1 + rand() % 30,
+               SSD1306_INVERSE); // Never empty, so every frame sends
+    Wire.clockCalls = 0;
+    g.display((f % 3) ? 40 : 0);
+    CHECK(Wire.clockCalls == 2);
+    route();
+    spanel.feed(SPI);
+    CHECK(panels[0 * 256 + 0x3C].matches(a));
+    CHECK(panels[1 * 256 + 0x3C].matches(b));
+    CHECK(panels[9 * 256 + 0x3D].matches(c, 128, 32));
+    CHECK(spanel.matches(s));
+  }
+
+  SSD1306_GroupStats total = g.getTotalStats(), bus = g.getBusStats(0);
+  CHECK(g.getStats(0).frames == 20);
+  CHECK(g.getStats(3).frames == 20);
+  CHECK(total.bytes >= bus.bytes);
+  CHECK(bus.bytes == g.getStats(0).bytes + g.getStats(1).bytes +
+                     g.getStats(2).bytes);
+  CHECK(g.getBusLoad(0) <= 100);
+  return report();
+}
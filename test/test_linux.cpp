@@ -0,0 +1,302 @@
+// Linux i2c-dev and spidev transports against a fake device, substituted
+// through Adafruit_SSD1306_LinuxIO. On I2C, each window's commands and
+// data must go in one I2C_RDWR call, as two messages led by control
+// bytes 0x00 and 0x40. On SPI, each D/C phase must be exactly one
+// SPI_IOC_MESSAGE call. Failed calls, or use before begin(), are counted
+// by getErrors() and don't stall display(). All of that holds with the
+// transports sending from threads of their own, too, and then an
+// Adafruit_SSD1306_Tiled with panels on two buses must have both buses
+// busy at once.
+
+#include "harness.h"
+#include <Adafruit_SSD1306_Linux.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+#include <chrono>
+#include <thread>
+
+#define FAKE_FD 7
+#define DC_PIN  9
+
+// One ioctl() or setDC() call, as the fake device saw it
+struct IOCall {
+  unsigned long request; // 0 for setDC()
+  bool          dc;      // setDC() level
+  uint8_t       nmsgs;   // I2C_RDWR messages
+  uint8_t       ctrl[2]; // Their control bytes
+  uint16_t      len[2];  // Their lengths, or the SPI transfer length
+};
+
+class FakeIO : public Adafruit_SSD1306_LinuxIO {
+public:
+  SSD1306_Emu         emu;
+  std::vector<IOCall> calls;
+  int                 opens, closes, failOpen, failIoctl;
+  bool                dc;
+  uint8_t             addr;
+  uint8_t             spiMode, spiBits;
+  uint32_t            spiSpeed;
+  int                 slowMs;  // Time each transfer takes
+  double              t0, t1;  // Start of first transfer, end of last, ms
+
+  FakeIO(void) : opens(0), closes(0), failOpen(0), failIoctl(0), dc(false),
+    addr(0x3C), spiMode(0xFF), spiBits(0), spiSpeed(0), slowMs(0), t0(0),
+    t1(0) {}
+
+  int open(const char *, int) {
+    opens++;
+    return failOpen ? -1 : FAKE_FD;
+  }
+  int close(int fd) {
+    CHECK(fd == FAKE_FD);
+    closes++;
+    return 0;
+  }
+  int ioctl(int fd, unsigned long request, void *arg) {
+    CHECK(fd == FAKE_FD);
+    if(slowMs && ((request == I2C_RDWR) || (request == SPI_IOC_MESSAGE(1)))) {
+      if(!t0) t0 = now();
+      std::this_thread::sleep_for(std::chrono::milliseconds(slowMs));
+      t1 = now();
+    }
+    IOCall c;
+    memset(&c, 0, sizeof(c));
+    c.request = request;
+    calls.push_back(c);
+    if(failIoctl) return -1;
+    if(request == I2C_RDWR) {
+      const struct i2c_rdwr_ioctl_data *x =
+        (const struct i2c_rdwr_ioctl_data *)arg;
+      calls.back().nmsgs = x->nmsgs;
+      for(uint32_t m = 0; m < x->nmsgs; m++) {
+        const struct i2c_msg &g = x->msgs[m];
+        CHECK(g.addr == addr);
+        CHECK(!(g.flags & I2C_M_RD));
+        CHECK(g.len >= 2);
+        if(m < 2) {
+          calls.back().ctrl[m] = g.buf[0];
+          calls.back().len[m]  = g.len;
+        }
+        emu.feed(g.buf, g.len);
+      }
+    } else if(request == SPI_IOC_MESSAGE(1)) {
+      const struct spi_ioc_transfer *t = (const struct spi_ioc_transfer *)arg;
+      const uint8_t *p = (const uint8_t *)(uintptr_t)t->tx_buf;
+      CHECK(!t->rx_buf);
+      calls.back().len[0] = t->len;
+      for(uint32_t i = 0; i < t->len; i++) {
+        dc ? emu.write(p[i]) : emu.command(p[i]);
+      }
+    } else if(request == SPI_IOC_WR_MODE) {
+      spiMode = *(uint8_t *)arg;
+    } else if(request == SPI_IOC_WR_BITS_PER_WORD) {
+      spiBits = *(uint8_t *)arg;
+    } else if(request == SPI_IOC_WR_MAX_SPEED_HZ) {
+      spiSpeed = *(uint32_t *)arg;
+    }
+    return 0;
+  }
+  void setDC(int8_t pin, boolean data) {
+    CHECK(pin == DC_PIN);
+    IOCall c;
+    memset(&c, 0, sizeof(c));
+    c.dc = dc = data;
+    calls.push_back(c);
+  }
+  static double now(void) {
+    return std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+};
+
+static void testI2C(bool threaded) {
+  FakeIO io;
+  {
+    Adafruit_SSD1306_LinuxI2C t("/dev/i2c-1", 0x3C, &io);
+    Adafruit_SSD1306          d(128, 64, &Wire);
+    CHECK(t.begin(threaded));
+    CHECK(t.begin(threaded)); // Already open
+    CHECK(io.opens == 1);
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    Wire.txns.clear();
+    d.setTransport(&t);
+
+    // Whole frame: one call, window commands then all the data
+    io.calls.clear();
+    d.display();
+    CHECK(io.calls.size() == 1);
+    if(io.calls.size() == 1) {
+      const IOCall &c = io.calls[0];
+      CHECK(c.request == I2C_RDWR);
+      CHECK(c.nmsgs == 2);
+      CHECK((c.ctrl[0] == 0x00) && (c.len[0] == 1 + 6));
+      CHECK((c.ctrl[1] == 0x40) && (c.len[1] == 1 + 1024));
+    }
+    CHECK(io.emu.matches(d));
+
+    // Partial frames: a window's first call carries its commands as well
+    srand(22);
+    for(int f = 0; f < 30; f++) {
+      d.fillRect(rand() % 128, rand() % 64, rand() % 60, rand() % 30,
+                 SSD1306_INVERSE);
+      io.calls.clear();
+      d.display();
+      for(size_t i = 0; i < io.calls.size(); i++) {
+        const IOCall &c = io.calls[i];
+        CHECK(c.request == I2C_RDWR);
+        if(c.nmsgs == 2) {
+          CHECK((c.ctrl[0] == 0x00) && (c.len[0] == 1 + 6));
+          CHECK(c.ctrl[1] == 0x40);
+        } else {
+          CHECK((c.nmsgs == 1) && (c.ctrl[0] == 0x40));
+        }
+      }
+      CHECK(io.emu.matches(d));
+    }
+    CHECK(t.getErrors() == 0);
+
+    // Failed calls are counted, and display() still returns
+    io.failIoctl = 1;
+    io.calls.clear();
+    d.fillRect(0, 0, 128, 64, SSD1306_INVERSE);
+    d.display();
+    CHECK(!d.isBusy());
+    CHECK(t.getErrors() == io.calls.size());
+    CHECK(t.getErrors() > 0);
+    io.failIoctl = 0;
+  }
+  CHECK(io.closes == 1);
+
+  // Not open: every write is an error, and nothing reaches the device
+  FakeIO io2;
+  io2.failOpen = 1;
+  {
+    Adafruit_SSD1306_LinuxI2C t("/dev/i2c-1", 0x3C, &io2);
+    CHECK(!t.begin(threaded));
+    uint8_t cmd[] = { SSD1306_DISPLAYON }, data[] = { 1, 2, 3 };
+    CHECK(t.write(cmd, sizeof(cmd), data, sizeof(data)));
+    CHECK(t.getErrors() == 1);
+    CHECK(io2.calls.empty());
+  }
+  CHECK(io2.closes == 0);
+}
+
+static void testSPI(bool threaded) {
+  FakeIO io;
+  {
+    Adafruit_SSD1306_LinuxSPI t("/dev/spidev0.0", DC_PIN, 10000000UL, &io);
+    Adafruit_SSD1306          d(128, 64, &SPI, DC_PIN, -1, 10);
+    CHECK(t.begin(threaded));
+    CHECK(io.spiMode == SPI_MODE_0);
+    CHECK(io.spiBits == 8);
+    CHECK(io.spiSpeed == 10000000UL);
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0));
+    SPI.log.clear();
+    d.setTransport(&t);
+
+    // Whole frame: D/C low, commands in one call, D/C high, data in one
+    io.calls.clear();
+    d.display();
+    CHECK(io.calls.size() == 4);
+    if(io.calls.size() == 4) {
+      CHECK(!io.calls[0].request && !io.calls[0].dc);
+      CHECK((io.calls[1].request == SPI_IOC_MESSAGE(1)) &&
+            (io.calls[1].len[0] == 6));
+      CHECK(!io.calls[2].request && io.calls[2].dc);
+      CHECK((io.calls[3].request == SPI_IOC_MESSAGE(1)) &&
+            (io.calls[3].len[0] == 1024));
+    }
+    CHECK(io.emu.matches(d));
+
+    // Partial frames: every transfer is the only one of its D/C phase
+    srand(23);
+    for(int f = 0; f < 30; f++) {
+      d.fillCircle(rand() % 128, rand() % 64, rand() % 20, SSD1306_INVERSE);
+      io.calls.clear();
+      d.display();
+      int inPhase = -1; // Transfers since the last setDC(), none yet
+      for(size_t i = 0; i < io.calls.size(); i++) {
+        const IOCall &c = io.calls[i];
+        if(!c.request) {
+          CHECK(inPhase != 0); // No empty phases
+          inPhase = 0;
+          continue;
+        }
+        CHECK(c.request == SPI_IOC_MESSAGE(1));
+        CHECK(++inPhase == 1);
+        CHECK(c.len[0] > 0);
+      }
+      CHECK(inPhase == 1);
+      CHECK(io.emu.matches(d));
+    }
+    CHECK(t.getErrors() == 0);
+
+    // Failed transfers are counted, one per phase
+    io.failIoctl = 1;
+    io.calls.clear();
+    d.fillRect(0, 0, 128, 64, SSD1306_INVERSE);
+    d.display();
+    CHECK(!d.isBusy());
+    CHECK(t.getErrors() == 2);
+    io.failIoctl = 0;
+  }
+  CHECK(io.closes == 1);
+
+  // Set-up failure closes the device again
+  FakeIO io2;
+  io2.failIoctl = 1;
+  {
+    Adafruit_SSD1306_LinuxSPI t("/dev/spidev0.0", DC_PIN, 8000000UL, &io2);
+    CHECK(!t.begin(threaded));
+    CHECK(io2.closes == 1);
+    uint8_t data[] = { 1, 2, 3 };
+    CHECK(t.write(NULL, 0, data, sizeof(data)));
+    CHECK(t.getErrors() == 1);
+  }
+  CHECK(io2.closes == 1);
+}
+
+// Two tiles, one on an I2C bus and one on SPI, each transfer taking
+// 50 ms: threaded, the buses' busy times must overlap; not, they mustn't.
+// Either way each panel ends up showing its tile.
+static void testTiled(bool threaded) {
+  FakeIO i2c, spi;
+  i2c.slowMs = spi.slowMs = 50;
+  {
+    Adafruit_SSD1306_LinuxI2C ti("/dev/i2c-1", 0x3C, &i2c);
+    Adafruit_SSD1306_LinuxSPI ts("/dev/spidev0.0", DC_PIN, 8000000UL, &spi);
+    Adafruit_SSD1306          a(128, 64, &Wire), b(128, 64, &SPI, DC_PIN, -1,
+                                10);
+    Adafruit_SSD1306_Tiled    t(256, 64);
+    CHECK(ti.begin(threaded));
+    CHECK(ts.begin(threaded));
+    CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    CHECK(b.begin(SSD1306_SWITCHCAPVCC, 0));
+    Wire.txns.clear();
+    SPI.log.clear();
+    a.setTransport(&ti);
+    b.setTransport(&ts);
+    CHECK(t.addTile(&a, 0, 0));
+    CHECK(t.addTile(&b, 128, 0));
+
+    t.fillRect(100, 10, 56, 40, SSD1306_INVERSE); // Across both tiles
+    t.display();
+    CHECK(i2c.emu.matches(a));
+    CHECK(spi.emu.matches(b));
+    bool overlap = (i2c.t0 < spi.t1) && (spi.t0 < i2c.t1);
+    CHECK(overlap == threaded);
+    CHECK((ti.getErrors() == 0) && (ts.getErrors() == 0));
+  }
+  CHECK((i2c.closes == 1) && (spi.closes == 1));
+}
+
+int main(void) {
+  SPI.dcPin = DC_PIN;
+  for(int threaded = 0; threaded < 2; threaded++) {
+    testI2C(threaded);
+    testSPI(threaded);
+    testTiled(threaded);
+  }
+  return report();
+}
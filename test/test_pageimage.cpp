@@ -0,0 +1,99 @@
+// drawPageImage() and sendPageImage() with the page-major and RLE output
+// of scripts/make_splash.py, in each diff mode and over I2C and SPI.
+// Drawn images must match blit() of the row-major bitmap; sent images
+// must reach only their part of the panel, leaving the buffer alone, and
+// the next display() must put the buffer's contents back, whatever is
+// drawn over the area in between.
+
+#include "harness.h"
+#include <splash.h>
+
+#define DC_PIN 5
+
+static SSD1306_Emu emu;
+
+// Hand the emulator whatever the display just sent, over either bus
+static void feed(void) {
+  emu.feed(Wire);
+  emu.feed(SPI);
+}
+
+int main(void) {
+  SPI.dcPin = DC_PIN;
+  srand(15);
+  for(int spi = 0; spi < 2; spi++) {
+    for(uint8_t mode = SSD1306_DIFF_NONE; mode <= SSD1306_DIFF_CHECKSUM;
+        mode++) {
+      Adafruit_SSD1306 *a = spi ?
+        new Adafruit_SSD1306(128, 64, &SPI, DC_PIN, -1, 4) :
+        new Adafruit_SSD1306(128, 64, &Wire);
+      Adafruit_SSD1306 b(128, 64, &Wire);
+      CHECK(a->begin(SSD1306_SWITCHCAPVCC, 0x3C));
+      CHECK(b.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+      CHECK(a->setDiffMode(mode));
+      emu.reset();
+      a->display();
+      feed();
+
+      for(int t = 0; t < 200; t++) {
+        bool big = t & 1, rle = rand() & 1;
+        int16_t x = rand() % 160 - 60, page = rand() % 10 - 3;
+        uint8_t w = big ? splash1_width : splash2_width,
+                pages = big ? splash1_pages : splash2_pages;
+        const uint8_t *img = big ?
+          (rle ? splash1_rle_data : splash1_page_data) :
+          (rle ? splash2_rle_data : splash2_page_data);
+        b.fillScreen(SSD1306_BLACK);
+        b.blit(x, page * 8, big ? splash1_data : splash2_data, w,
+               big ? splash1_height : splash2_height, SSD1306_ROP_COPY);
+        const uint8_t *want = b.getBufferReadOnly();
+
+        if(!(t % 3)) {
+          a->fillScreen(SSD1306_BLACK);
+          a->drawPageImage(x, page, img, w, pages, rle);
+          CHECK(!memcmp(a->getBufferReadOnly(), want, 1024));
+        } else {
+          uint8_t before[1024];
+          memcpy(before, emu.ram, sizeof(before));
+          a->sendPageImage(x, page, img, w, pages, rle);
+          feed();
+          bool same = true;
+          for(int16_t p = 0; p < 8; p++) {
+            for(int16_t c = 0; c < 128; c++) {
+              bool in = (p >= page) && (p < page + pages) && (c >= x) &&
+                        (c < x + w);
+              same &= emu.ram[p * 128 + c] ==
+                      (in ? want[p * 128 + c] : before[p * 128 + c]);
+            }
+          }
+          CHECK(same);
+        }
+        a->display();
+        feed();
+        CHECK(emu.matches(*a));
+      }
+      delete a;
+    }
+  }
+
+  // Sent over a displayed frame, then the complement of that frame drawn
+  // there: the shadow copy must not take it for what the panel shows
+  for(uint8_t mode = SSD1306_DIFF_SHADOW; mode <= SSD1306_DIFF_CHECKSUM;
+      mode++) {
+    Adafruit_SSD1306 a(128, 64, &Wire);
+    CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    CHECK(a.setDiffMode(mode));
+    for(int i = 0; i < 40; i++) {
+      a.fillRect(rand() % 128, rand() % 64, rand() % 30, rand() % 20,
+                 SSD1306_INVERSE);
+    }
+    emu.reset();
+    a.display();
+    a.sendPageImage(16, 2, splash2_page_data, splash2_width, splash2_pages);
+    a.fillRect(16, 16, splash2_width, splash2_pages * 8, SSD1306_INVERSE);
+    a.display();
+    feed();
+    CHECK(emu.matches(a));
+  }
+  return report();
+}
@@ -0,0 +1,70 @@
+// Threaded render/present pipeline, with each queue depth, overflow
+// policy and coalescing option, presenting through a transport slower
+// than drawing. Every frame submitted is presented, dropped or
+// coalesced, blocking without coalescing presents all of them, and the
+// panel ends up showing the last frame. Blocking must still wait after
+// a spell of submitting slower than the presenter takes frames.
+
+#include "harness.h"
+#include <Adafruit_SSD1306_Linux.h>
+#include <unistd.h>
+
+// Applies each write to an emulated panel, taking a set time over it
+class SlowTransport : public Adafruit_SSD1306_Transport {
+public:
+  SSD1306_Emu emu;
+  int         writes, us;
+
+  SlowTransport(int us) : writes(0), us(us) {}
+  boolean write(const uint8_t *cmd, uint8_t cmdLen, const uint8_t *data,
+                uint16_t len) {
+    writes++;
+    for(uint8_t i = 0; i < cmdLen; i++) emu.command(cmd[i]);
+    for(uint16_t i = 0; i < len; i++) emu.write(data[i]);
+    if(us) usleep(us);
+    return true;
+  }
+  boolean busy(void) { return false; }
+};
+
+static void run(uint8_t depth, uint8_t policy, boolean coalesce, int us,
+                int idle = 0) {
+  Adafruit_SSD1306 d(128, 64, &Wire);
+  SlowTransport    t(us);
+  CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  Wire.txns.clear();
+
+  Adafruit_SSD1306_Pipeline p(&d, &t, depth, policy, coalesce);
+  CHECK(!p.submit()); // Not started
+  CHECK(p.begin());
+  for(int f = 0; f < 300; f++) {
+    if(f < idle) usleep(us * 20); // Presenter keeps up, queue stays empty
+    d.fillRect(rand() % 128, rand() % 64, rand() % 50, rand() % 30,
+               SSD1306_INVERSE);
+    CHECK(p.submit());
+  }
+  p.end();
+
+  SSD1306_PipelineStats s = p.getStats();
+  printf("depth %u policy %u coalesce %u: presented %u dropped %u "
+         "coalesced %u, latency %u us (max %u)\n", depth, policy, coalesce,
+         s.presented, s.dropped, s.coalesced, s.latency, s.maxLatency);
+  CHECK(s.submitted == 300);
+  CHECK(s.presented + s.dropped + s.coalesced == 300);
+  if((policy == SSD1306_PIPELINE_BLOCK) && !coalesce) {
+    CHECK(s.presented == 300);
+  }
+  CHECK(s.maxLatency >= s.latency);
+  CHECK(t.emu.matches(d));
+}
+
+int main(void) {
+  srand(23);
+  run(2, SSD1306_PIPELINE_DROP_OLDEST, true, 200);
+  run(3, SSD1306_PIPELINE_DROP_OLDEST, false, 200);
+  run(1, SSD1306_PIPELINE_BLOCK, false, 50);
+  run(2, SSD1306_PIPELINE_BLOCK, false, 50, 100);
+  run(4, SSD1306_PIPELINE_BLOCK, true, 50);
+  run(8, SSD1306_PIPELINE_DROP_OLDEST, true, 0);
+  return report();
+}
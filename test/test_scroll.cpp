@@ -0,0 +1,72 @@
+// Software scrolling: scrollBuffer() and scrollRegion() on each panel
+// height, in every rotation, with regions that clip and shifts in any
+// direction (including whole pages, which take a faster path), against
+// a pixel-by-pixel model. Uncovered pixels take the fill color, pixels
+// outside the region don't change, and display() sends what changed.
+
+#include "harness.h"
+
+static bool before[128][128]; // Pixels before the scroll, [y][x]
+
+int main(void) {
+  srand(25);
+  for(uint8_t panel = 16; panel <= 64; panel *= 2) {
+    Adafruit_SSD1306 d(128, panel, &Wire);
+    SSD1306_Emu      emu;
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    emu.feed(Wire);
+
+    for(int it = 0; it < 4000; it++) {
+      d.setRotation(rand() % 4);
+      int16_t W = d.width(), H = d.height();
+      for(uint8_t k = 0; k < 5; k++) {
+        d.fillCircle(rand() % W, rand() % H, rand() % 15, SSD1306_INVERSE);
+      }
+      for(int16_t y = 0; y < H; y++) {
+        for(int16_t x = 0; x < W; x++) before[y][x] = d.getPixel(x, y);
+      }
+      int16_t x = rand() % (W + 20) - 10, y = rand() % (H + 20) - 10,
+              w = rand() % (W + 10), h = rand() % (H + 10);
+      if(!(it % 5)) { // Whole buffer
+        x = y = 0;
+        w = W;
+        h = H;
+      }
+      int16_t dx = rand() % (w + 3) - (w + 3) / 2,
+              dy = rand() % (h + 3) - (h + 3) / 2;
+      if(!(it % 7)) { // Whole pages, for the page-aligned path
+        dx = 0;
+        dy = (rand() % 3 - 1) * 8;
+        y &= ~7;
+        h &= ~7;
+      }
+      uint16_t color = (rand() % 2) ? SSD1306_WHITE : SSD1306_BLACK;
+      d.display();
+      emu.feed(Wire);
+
+      if(!(it % 5)) d.scrollBuffer(dx, dy, color);
+      else d.scrollRegion(x, y, w, h, dx, dy, color);
+
+      bool same = true;
+      for(int16_t yy = 0; yy < H; yy++) {
+        for(int16_t xx = 0; xx < W; xx++) {
+          bool in = (xx >= x) && (xx < x + w) && (yy >= y) && (yy < y + h),
+               want = before[yy][xx];
+          if(in) {
+            int16_t sx = xx - dx, sy = yy - dy;
+            bool    src = (sx >= x) && (sx < x + w) && (sy >= y) &&
+                          (sy < y + h) && (sx >= 0) && (sy >= 0) &&
+                          (sx < W) && (sy < H);
+            want = src ? before[sy][sx] : (color == SSD1306_WHITE);
+          }
+          same &= d.getPixel(xx, yy) == want;
+        }
+      }
+      CHECK(same);
+      d.display();
+      emu.feed(Wire);
+      CHECK(emu.matches(d, 128, panel));
+    }
+  }
+  return report();
+}
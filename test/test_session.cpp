@@ -0,0 +1,90 @@
+// Bus sessions and command coalescing: begin() changes the I2C clock
+// once and sends its commands in full transmissions; a session shares
+// one clock change (or, on SPI, one transaction and chip select) among
+// all the calls inside it, nests, and ignores an unmatched end.
+
+#include "harness.h"
+
+#define DC_PIN 5
+#define CS_PIN 4
+
+int main(void) {
+  Adafruit_SSD1306 a(128, 64, &Wire);
+  SSD1306_Emu      emu;
+  Wire.txns.clear();
+  Wire.clockCalls = 0;
+  CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true, SSD1306_SPLASH_NONE));
+  CHECK(Wire.clockCalls == 2);
+  CHECK(Wire.txns.size() <= 2);
+  CHECK(Wire.overruns == 0);
+  emu.feed(Wire);
+
+  // Without a session, each call sets the clock up and back
+  Wire.clockCalls = 0;
+  for(uint8_t i = 0; i < 10; i++) {
+    a.ssd1306_command(SSD1306_SETCONTRAST);
+    a.ssd1306_command(i);
+  }
+  CHECK(Wire.clockCalls == 2 * 20);
+  emu.feed(Wire);
+
+  // In one, the clock is set once, but each call's commands still go out
+  // when the call returns, leaving the bus free for other devices
+  Wire.clockCalls = 0;
+  a.beginBusSession();
+  for(uint8_t i = 0; i < 10; i++) {
+    a.ssd1306_command(SSD1306_SETCONTRAST);
+    a.ssd1306_command(i);
+  }
+  a.drawPixel(5, 5, SSD1306_WHITE);
+  a.display();
+  a.beginBusSession();
+  a.dim(true);
+  a.endBusSession();
+  a.endBusSession();
+  a.endBusSession(); // Unmatched, ignored
+  CHECK(Wire.clockCalls == 2);
+  size_t commandTxns = 0;
+  for(size_t t = 0; t < Wire.txns.size(); t++) {
+    commandTxns += !Wire.txns[t].bytes[0]; // Control byte 0x00
+  }
+  CHECK(commandTxns == 20 + 1 + 1); // Contrast, display window, dim
+  CHECK(Wire.txns.back().clock == 400000);
+  emu.feed(Wire);
+  CHECK(emu.matches(a));
+
+  // And afterwards display() goes back to one clock change each way
+  Wire.clockCalls = 0;
+  a.drawPixel(9, 9, SSD1306_WHITE);
+  a.display();
+  CHECK(Wire.clockCalls == 2);
+  CHECK(Wire.clock == 100000);
+  emu.feed(Wire);
+  CHECK(emu.matches(a));
+
+  // SPI: one transaction, one chip select for the session
+  Adafruit_SSD1306 s(128, 64, &SPI, DC_PIN, -1, CS_PIN);
+  SSD1306_Emu      semu;
+  SPI.dcPin = DC_PIN;
+  CHECK(s.begin(SSD1306_SWITCHCAPVCC, 0));
+  semu.feed(SPI);
+  unsigned long transactions = SPI.transactions;
+  pinEvents.clear();
+  pinHook = recordPin;
+  s.beginBusSession();
+  for(uint8_t i = 0; i < 10; i++) s.ssd1306_command(SSD1306_DISPLAYON);
+  s.drawPixel(1, 1, SSD1306_WHITE);
+  s.display();
+  s.endBusSession();
+  pinHook = NULL;
+  CHECK(SPI.transactions - transactions == 1);
+  int selects = 0;
+  for(size_t i = 0; i < pinEvents.size(); i++) {
+    selects += (pinEvents[i].pin == CS_PIN) && (pinEvents[i].val == LOW);
+  }
+  CHECK(selects == 1);
+  CHECK(digitalRead(CS_PIN) == HIGH);
+  semu.feed(SPI);
+  CHECK(semu.matches(s));
+  return report();
+}
@@ -0,0 +1,130 @@
+// Bitbang SPI pin waveform, as seen through digitalWrite(): SPI mode 0,
+// MSB first. While the display is selected, MOSI and D/C may only change
+// with the clock low, so each is stable before the rising edge that
+// samples it; every byte takes exactly 8 rising edges, D/C is fixed
+// across a byte (low for commands, high for data), and the clock is left
+// low at the end of every transfer.
+//
+// Built twice: once writing pins with digitalWrite(), and once with
+// HAVE_PORTREG (test_softspi_portreg), where the unrolled port register
+// path runs against the stand-in ports in stubs/, all four pins sharing
+// one port. That build also checks the cycle accounting the library
+// relies on: exactly one MOSI and two clock writes per bit.
+
+#include "harness.h"
+
+#define MOSI_PIN 6
+#define CLK_PIN  7
+#define DC_PIN   5
+#define CS_PIN   4
+
+// Walk pinEvents checking the rules above, and return the bytes sent
+static std::vector<SPIByte> checkWaveform(void) {
+  std::vector<SPIByte> out;
+  uint8_t level[ARDUINO_STUB_PINS] = { 0 }, bits = 0, shift = 0;
+  bool    selected = false, dcAtStart = false;
+  level[CS_PIN] = HIGH;
+  for(size_t i = 0; i < pinEvents.size(); i++) {
+    const PinEvent &e = pinEvents[i];
+    bool rising = (e.pin == CLK_PIN) && !level[CLK_PIN] && e.val;
+    if(selected && level[CLK_PIN]) { // Clock high: only it may change
+      CHECK((e.pin == CLK_PIN) || (level[e.pin] == e.val));
+    }
+    if((e.pin == DC_PIN) && (level[DC_PIN] != e.val)) {
+      CHECK(!bits); // D/C changes between bytes only
+    }
+    if(e.pin == CS_PIN) {
+      if(e.val) { // Deselected: whole bytes sent, clock back low
+        CHECK(!bits);
+        CHECK(!level[CLK_PIN]);
+      }
+      selected = !e.val;
+    }
+    level[e.pin] = e.val;
+    if(!rising) continue;
+    CHECK(selected);
+    if(!bits) dcAtStart = level[DC_PIN];
+    shift = (shift << 1) | level[MOSI_PIN]; // First edge is the MSB
+    if(++bits == 8) {
+      CHECK(level[DC_PIN] == dcAtStart);
+      SPIByte b = { level[DC_PIN] == HIGH, shift };
+      out.push_back(b);
+      bits = shift = 0;
+    }
+  }
+  CHECK(!bits);
+  CHECK(!level[CLK_PIN]);
+  return out;
+}
+
+static size_t risingEdges(void) {
+  size_t n = 0;
+  uint8_t clk = LOW;
+  for(size_t i = 0; i < pinEvents.size(); i++) {
+    if(pinEvents[i].pin != CLK_PIN) continue;
+    n  += !clk && pinEvents[i].val;
+    clk = pinEvents[i].val;
+  }
+  return n;
+}
+
+int main(void) {
+  Adafruit_SSD1306 d(128, 64, MOSI_PIN, CLK_PIN, DC_PIN, -1, CS_PIN);
+  SSD1306_Emu      emu;
+  pinEvents.clear();
+  pinHook = recordPin;
+  CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0));
+  d.clearDisplay();
+  d.display();
+  std::vector<SPIByte> bytes = checkWaveform();
+  CHECK(risingEdges() == 8 * bytes.size());
+  emu.feed(bytes);
+
+  // Known bytes, none of them the same backwards: contrast 0x10 (LSB
+  // first would read 0x08), then a window and one data byte of 0x01
+  pinEvents.clear();
+  d.ssd1306_command(SSD1306_SETCONTRAST);
+  d.ssd1306_command(0x10);
+  d.drawPixel(0, 0, SSD1306_WHITE);
+  d.display();
+  bytes = checkWaveform();
+  CHECK(risingEdges() == 8 * bytes.size());
+  static const SPIByte want[] = {
+    { false, SSD1306_SETCONTRAST }, { false, 0x10 },
+    { false, SSD1306_PAGEADDR }, { false, 0 }, { false, 0 },
+    { false, SSD1306_COLUMNADDR }, { false, 0 }, { false, 0 },
+    { true, 0x01 }
+  };
+  CHECK(bytes.size() == sizeof(want) / sizeof(want[0]));
+  for(size_t i = 0; (i < bytes.size()) && (i < sizeof(want) / sizeof(want[0]));
+      i++) {
+    CHECK(bytes[i].data == want[i].data);
+    CHECK(bytes[i].value == want[i].value);
+  }
+  emu.feed(bytes);
+  CHECK(emu.matches(d));
+
+  // Whole frames of random bytes, checked the same way
+  srand(11);
+  for(int f = 0; f < 10; f++) {
+    pinEvents.clear();
+    uint8_t *buf = d.getBuffer();
+    for(int i = 0; i < 1024; i++) buf[i] = rand();
+    memset(portWrites, 0, sizeof(portWrites));
+    d.display();
+    bytes = checkWaveform();
+    CHECK(risingEdges() == 8 * bytes.size());
+#ifdef HAVE_PORTREG
+    CHECK(portWrites[MOSI_PIN] == 8 * bytes.size());
+    CHECK(portWrites[CLK_PIN] == 16 * bytes.size());
+#else
+    CHECK(!portWrites[MOSI_PIN] && !portWrites[CLK_PIN]);
+#endif
+    emu.feed(bytes);
+    CHECK(emu.matches(d));
+  }
+  pinHook = NULL;
+  CHECK(digitalRead(CS_PIN) == HIGH);
+  CHECK(digitalRead(CLK_PIN) == LOW);
+  return report();
+}
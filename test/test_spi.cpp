@@ -0,0 +1,48 @@
+// Hardware and bitbang SPI must deliver the same frames, commands with
+// D/C low and data with D/C high, and hardware SPI must send frame data
+// as block transfers rather than one transfer() per byte.
+
+#include "harness.h"
+
+#define MOSI_PIN 6
+#define CLK_PIN  7
+#define DC_PIN   5
+#define CS_PIN   4
+
+int main(void) {
+  SPI.dcPin = DC_PIN;
+  for(int soft = 0; soft < 2; soft++) {
+    Adafruit_SSD1306 *d = soft ?
+      new Adafruit_SSD1306(128, 64, MOSI_PIN, CLK_PIN, DC_PIN, -1, CS_PIN) :
+      new Adafruit_SSD1306(128, 64, &SPI, DC_PIN, -1, CS_PIN);
+    SSD1306_Emu emu;
+    srand(9);
+    pinEvents.clear();
+    pinHook = recordPin;
+    CHECK(d->begin(SSD1306_SWITCHCAPVCC, 0));
+
+    for(int f = 0; f < 50; f++) {
+      for(int i = 0; i < 20; i++) {
+        d->drawPixel(rand() % 128, rand() % 64, rand() % 3);
+      }
+      d->drawFastHLine(rand() % 128, rand() % 64, rand() % 60, 1);
+      unsigned long transfers = SPI.transfers;
+      d->display();
+      if(soft) {
+        std::vector<SPIByte> bytes = decodeSoftSPI(pinEvents, MOSI_PIN,
+                                                   CLK_PIN, DC_PIN);
+        pinEvents.clear();
+        CHECK(SPI.log.empty());
+        emu.feed(bytes);
+      } else {
+        // At most a window command list and two blocks of data per page
+        CHECK(SPI.transfers - transfers <= 8 * 3);
+        emu.feed(SPI);
+      }
+      CHECK(emu.matches(*d));
+    }
+    pinHook = NULL;
+    delete d;
+  }
+  return report();
+}
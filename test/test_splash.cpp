@@ -0,0 +1,58 @@
+// begin()'s splash options on each panel size and diff mode: the drawn
+// splash matches drawBitmap() of the splash bitmap, SPLASH_SEND puts the
+// same image on the panel while leaving the buffer clear, and the first
+// display() afterwards replaces it with the buffer. SPLASH_NONE leaves
+// the buffer clear.
+
+#include "harness.h"
+#include <splash.h>
+
+int main(void) {
+  const uint8_t sizes[][2] = { { 128, 64 }, { 128, 32 }, { 96, 16 } };
+  for(uint8_t s = 0; s < 3; s++) {
+    uint8_t w = sizes[s][0], h = sizes[s][1], pages = h / 8;
+    for(uint8_t mode = SSD1306_DIFF_NONE; mode <= SSD1306_DIFF_CHECKSUM;
+        mode++) {
+      Adafruit_SSD1306 ref(w, h, &Wire), bmp(w, h, &Wire), a(w, h, &Wire),
+                       none(w, h, &Wire);
+      SSD1306_Emu emu;
+      CHECK(ref.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+      CHECK(bmp.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                      SSD1306_SPLASH_NONE));
+      if(h > 32) {
+        bmp.drawBitmap((w - splash1_width) / 2, (h - splash1_height) / 2,
+                       splash1_data, splash1_width, splash1_height, 1);
+      } else {
+        bmp.drawBitmap((w - splash2_width) / 2, (h - splash2_height) / 2,
+                       splash2_data, splash2_width, splash2_height, 1);
+      }
+      CHECK(!memcmp(ref.getBufferReadOnly(), bmp.getBufferReadOnly(),
+                    w * pages));
+      Wire.txns.clear();
+
+      CHECK(a.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                    SSD1306_SPLASH_SEND));
+      CHECK(a.setDiffMode(mode));
+      emu.feed(Wire);
+      CHECK(emu.matches(ref.getBufferReadOnly(), w, h));
+      bool clear = true;
+      for(uint16_t i = 0; i < w * pages; i++) clear &= !a.getBufferReadOnly()[i];
+      CHECK(clear);
+
+      a.drawPixel(0, 0, SSD1306_WHITE);
+      a.display();
+      emu.feed(Wire);
+      CHECK(emu.matches(a, w, h));
+
+      CHECK(none.begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                       SSD1306_SPLASH_NONE));
+      clear = true;
+      for(uint16_t i = 0; i < w * pages; i++) {
+        clear &= !none.getBufferReadOnly()[i];
+      }
+      CHECK(clear);
+      Wire.txns.clear();
+    }
+  }
+  return report();
+}
@@ -0,0 +1,79 @@
+// Adafruit_SSD1306_Static draws exactly like Adafruit_SSD1306 in every
+// rotation, through its own pixel, line, rectangle and screen fills, and
+// its frames reach the panel intact.
+
+#include "harness.h"
+
+int main(void) {
+  static Adafruit_SSD1306_Static<128, 64> s(&Wire);
+  Adafruit_SSD1306 d(128, 64, &Wire);
+  SSD1306_Emu      emu;
+  srand(10);
+  CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  Wire.txns.clear();
+  CHECK(s.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  s.display();
+  emu.feed(Wire);
+  CHECK(!memcmp(s.getBufferReadOnly(), d.getBufferReadOnly(), 1024));
+
+  for(int f = 0; f < 200; f++) {
+    s.setRotation(f & 3);
+    d.setRotation(f & 3);
+    for(int i = 0; i < 40; i++) {
+      int16_t  x = rand() % 140 - 6, y = rand() % 140 - 6,
+               w = rand() % 150 - 10, h = rand() % 80 - 10;
+      uint16_t c = rand() % 3;
+      switch(rand() % 8) {
+      case 0: case 1: case 2: case 3:
+        s.drawPixel(x, y, c);
+        d.drawPixel(x, y, c);
+        break;
+      case 4:
+        s.drawFastHLine(x, y, w, c);
+        d.drawFastHLine(x, y, w, c);
+        break;
+      case 5:
+        s.drawFastVLine(x, y, h, c);
+        d.drawFastVLine(x, y, h, c);
+        break;
+      case 6:
+        s.fillRect(x, y, w, h, c);
+        d.fillRect(x, y, w, h, c);
+        break;
+      case 7:
+        if(rand() % 8) break; // Keep most frames partial
+        s.fillScreen(c);
+        d.fillScreen(c);
+        break;
+      }
+    }
+    s.display();
+    emu.feed(Wire);
+    CHECK(!memcmp(s.getBufferReadOnly(), d.getBufferReadOnly(), 1024));
+    CHECK(emu.matches(s));
+  }
+
+  Adafruit_SSD1306_Static<64, 32> *small =
+    new Adafruit_SSD1306_Static<64, 32>(&Wire);
+  Adafruit_SSD1306 ds(64, 32, &Wire);
+  CHECK(ds.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  CHECK(small->begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  CHECK((sizeof(*small) >= Adafruit_SSD1306_Static<64, 32>::BUFFER_BYTES));
+  for(int r = 0; r < 4; r++) { // A row stride other than 128
+    small->setRotation(r);
+    ds.setRotation(r);
+    for(int i = 0; i < 200; i++) {
+      int16_t  x = rand() % 80 - 8, y = rand() % 80 - 8,
+               w = rand() % 80 - 8, h = rand() % 40 - 4;
+      uint16_t c = rand() % 3;
+      small->fillRect(x, y, w, h, c);
+      ds.fillRect(x, y, w, h, c);
+      small->drawFastVLine(y, x, w, c);
+      ds.drawFastVLine(y, x, w, c);
+    }
+    CHECK(!memcmp(small->getBufferReadOnly(), ds.getBufferReadOnly(), 256));
+  }
+  delete small;
+  Wire.txns.clear();
+  return report();
+}
@@ -0,0 +1,58 @@
+// Built with SSD1306_ENABLE_STATS and SSD1306_ENABLE_TRACE. The traffic
+// counters must agree with what actually went over the bus, and trace
+// events must pair up, with one chunk event per I2C transmission.
+
+#include "harness.h"
+
+static unsigned long events[5], eventBytes[5];
+
+static void hook(Adafruit_SSD1306 *, uint8_t event, uint16_t count) {
+  events[event]++;
+  eventBytes[event] += count;
+}
+
+int main(void) {
+  Adafruit_SSD1306::setTraceHook(hook);
+  Adafruit_SSD1306 d(128, 64, &Wire);
+  SSD1306_Emu      emu;
+  CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  emu.feed(Wire);
+  emu.commands = emu.data = emu.txns = 0; // Count from here, like the stats
+  d.resetStats();
+  memset(events, 0, sizeof(events));
+  memset(eventBytes, 0, sizeof(eventBytes));
+  Wire.clockCalls = 0;
+
+  d.display();
+  for(uint8_t i = 0; i < 10; i++) {
+    d.drawPixel(i * 9, i * 5, SSD1306_WHITE);
+    d.display();
+  }
+  d.invertDisplay(true);
+
+  unsigned long bytes = 0, txns = Wire.txns.size();
+  for(size_t t = 0; t < Wire.txns.size(); t++) bytes += Wire.txns[t].bytes.size();
+  emu.feed(Wire);
+  CHECK(emu.matches(d));
+
+  const SSD1306_Stats &s = d.getStats();
+  CHECK(s.bytes == bytes);
+  CHECK(s.i2cTransmissions == txns);
+  CHECK(s.dataBytes == emu.data);
+  CHECK(s.commandBytes == emu.commands);
+  CHECK(s.bytes == s.dataBytes + s.commandBytes + s.i2cTransmissions);
+  CHECK(s.clockChanges == Wire.clockCalls);
+  CHECK(s.frames == 11);
+  CHECK(s.spiTransactions == 0);
+  CHECK(s.displayMicros >= s.commandMicros);
+
+  CHECK(events[SSD1306_TRACE_COMMAND_BEGIN] == events[SSD1306_TRACE_COMMAND_END]);
+  CHECK(eventBytes[SSD1306_TRACE_COMMAND_END] == s.commandBytes);
+  CHECK(events[SSD1306_TRACE_DATA_BEGIN] == events[SSD1306_TRACE_DATA_END]);
+  CHECK(eventBytes[SSD1306_TRACE_DATA_END] == s.dataBytes);
+  CHECK(events[SSD1306_TRACE_CHUNK] == txns);
+
+  d.resetStats();
+  CHECK(d.getStats().bytes == 0);
+  return report();
+}
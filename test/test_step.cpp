@@ -0,0 +1,46 @@
+// displayStep() time slices, mixed with drawing, display() and
+// displayAsync() over Wire, must add up to a correct panel.
+
+#include "harness.h"
+
+int main(void) {
+  Adafruit_SSD1306 d(128, 64, &Wire);
+  SSD1306_Emu      emu;
+  long             steps = 0;
+  srand(4);
+  CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+  emu.feed(Wire);
+
+  for(int i = 0; i < 5000; i++) {
+    int16_t x = rand() % 160 - 16, y = rand() % 100 - 16, l = rand() % 80 - 5;
+    uint16_t c = rand() % 3;
+    switch(rand() % 5) {
+    case 0: d.drawPixel(x, y, c); break;
+    case 1: d.drawFastHLine(x, y, l, c); break;
+    case 2: d.drawFastVLine(x, y, l, c); break;
+    case 3:
+      d.displayStep(rand() % 50, (rand() % 2) ? 0 : 5);
+      steps++;
+      emu.feed(Wire);
+      break;
+    case 4:
+      if(!(rand() % 10)) {
+        d.display();
+        emu.feed(Wire);
+        CHECK(emu.matches(d));
+      } else if(!(rand() % 3)) {
+        d.displayAsync();
+        while(d.isBusy()) emu.feed(Wire);
+        emu.feed(Wire);
+      }
+      break;
+    }
+  }
+  // A frame sent in 1-byte steps arrives whole
+  d.fillScreen(SSD1306_INVERSE);
+  while(!d.displayStep(1)) emu.feed(Wire);
+  emu.feed(Wire);
+  CHECK(emu.matches(d));
+  CHECK(steps > 0);
+  return report();
+}
@@ -0,0 +1,191 @@
+// Adafruit_SSD1306_Tiled: a 2x2 wall of 128x64 panels with 4-pixel gaps
+// between them, one mounted upside down, drawn on in every rotation of
+// the canvas. Each panel must hold its part of the same drawing done on
+// a plain pixel canvas, with nothing drawn in the gaps.
+//
+// The panels sit on channels of an I2C multiplexer, each with its own
+// emulated display. After a few small drawing calls per frame, panels
+// the calls didn't touch must get no traffic at all, and the others
+// only their changed window: in each page, exactly the columns from the
+// first to the last pixel drawn there.
+
+#include "harness.h"
+
+#define CANVAS_W 260
+#define CANVAS_H 132
+#define MUX_ADDR 0x70
+
+// Reference canvas, one byte per pixel, noting every pixel drawn to
+class PixelCanvas : public Adafruit_GFX {
+public:
+  uint8_t px[CANVAS_H][CANVAS_W];
+  bool    touched[CANVAS_H][CANVAS_W];
+  PixelCanvas(void) : Adafruit_GFX(CANVAS_W, CANVAS_H) {
+    memset(px, 0, sizeof(px));
+    memset(touched, 0, sizeof(touched));
+  }
+  void drawPixel(int16_t x, int16_t y, uint16_t c) {
+    if((x < 0) || (y < 0) || (x >= width()) || (y >= height())) return;
+    int16_t t;
+    switch(getRotation()) {
+    case 1: t = x; x = WIDTH - 1 - y; y = t; break;
+    case 2: x = WIDTH - 1 - x; y = HEIGHT - 1 - y; break;
+    case 3: t = x; x = y; y = HEIGHT - 1 - t; break;
+    }
+    uint8_t &p = px[y][x];
+    p = (c == SSD1306_INVERSE) ? !p : (c != SSD1306_BLACK);
+    touched[y][x] = true;
+  }
+};
+
+static SSD1306_Emu panels[4]; // By mux channel
+static int         channel = -1;
+
+// Hand each I2C transmission to the panel it reached
+static void route(void) {
+  for(size_t t = 0; t < Wire.txns.size(); t++) {
+    const WireTransmission &x = Wire.txns[t];
+    if(x.addr == MUX_ADDR) {
+      channel = x.bytes[0];
+    } else {
+      CHECK((x.addr == 0x3C) && (channel >= 0) && (channel < 4));
+      panels[channel].feed(x.bytes.data(), x.bytes.size());
+    }
+  }
+  Wire.txns.clear();
+}
+
+static void selectChannel(uint8_t c) {
+  route();
+  Wire.beginTransmission(MUX_ADDR);
+  Wire.write(c);
+  Wire.endTransmission();
+}
+static void mux0(Adafruit_SSD1306 *) { selectChannel(0); }
+static void mux1(Adafruit_SSD1306 *) { selectChannel(1); }
+static void mux2(Adafruit_SSD1306 *) { selectChannel(2); }
+static void mux3(Adafruit_SSD1306 *) { selectChannel(3); }
+static const SSD1306_Callback muxes[4] = { mux0, mux1, mux2, mux3 };
+
+// One random drawing call, on the tiles and the reference alike
+static void draw(Adafruit_SSD1306_Tiled &t, PixelCanvas *r, int16_t size,
+                 bool screen) {
+  int16_t x = rand() % 300 - 20, y = rand() % 300 - 20,
+          w = rand() % size - 20, h = rand() % (size * 2 / 3) - 20;
+  uint16_t c = rand() % 3;
+  switch(rand() % (screen ? 5 : 4)) {
+  case 0:
+    t.drawPixel(x, y, c);
+    r->drawPixel(x, y, c);
+    break;
+  case 1:
+    t.drawFastHLine(x, y, abs(w), c);
+    for(int16_t i = 0; i < abs(w); i++) r->drawPixel(x + i, y, c);
+    break;
+  case 2:
+    t.drawFastVLine(x, y, abs(h), c);
+    for(int16_t i = 0; i < abs(h); i++) r->drawPixel(x, y + i, c);
+    break;
+  case 3: // Non-positive sizes draw nothing
+    t.fillRect(x, y, w, h, c);
+    for(int16_t j = 0; j < h; j++) {
+      for(int16_t i = 0; i < w; i++) r->drawPixel(x + i, y + j, c);
+    }
+    break;
+  case 4: // Only the panels get filled, not the gaps
+    if(c == SSD1306_INVERSE) break;
+    t.fillScreen(c);
+    for(int16_t yy = 0; yy < CANVAS_H; yy++) {
+      for(int16_t xx = 0; xx < CANVAS_W; xx++) {
+        bool gap = ((xx >= 128) && (xx < 132)) || ((yy >= 64) && (yy < 68));
+        if(!gap) r->px[yy][xx] = c;
+      }
+    }
+    break;
+  }
+}
+
+int main(void) {
+  const int16_t ox[4] = { 0, 132, 0, 132 }, oy[4] = { 0, 0, 68, 68 };
+  int quiet = 0, partial = 0; // Panels checked with no, or some, changes
+  for(uint8_t rot = 0; rot < 4; rot++) {
+    for(int seed = 0; seed < 15; seed++) {
+      Adafruit_SSD1306      *d[4];
+      Adafruit_SSD1306_Tiled t(CANVAS_W, CANVAS_H);
+      PixelCanvas           *r = new PixelCanvas;
+      for(uint8_t i = 0; i < 4; i++) {
+        d[i] = new Adafruit_SSD1306(128, 64, &Wire);
+        panels[i].reset();
+        muxes[i](d[i]);
+        CHECK(d[i]->begin(SSD1306_SWITCHCAPVCC, 0x3C, true, true,
+                          SSD1306_SPLASH_NONE));
+        CHECK(t.addTile(d[i], ox[i], oy[i], (i == 3) ? 2 : 0, muxes[i]));
+      }
+      route();
+      t.setRotation(rot);
+      r->setRotation(rot);
+
+      srand(seed);
+      for(int k = 0; k < 60; k++) draw(t, r, 150, true);
+      for(uint8_t i = 0; i < 4; i++) {
+        bool same = true;
+        for(int16_t y = 0; y < 64; y++) {
+          for(int16_t x = 0; x < 128; x++) {
+            same &= d[i]->getPixel(x, y) == r->px[oy[i] + y][ox[i] + x];
+          }
+        }
+        CHECK(same);
+      }
+      t.display();
+      route();
+      for(uint8_t i = 0; i < 4; i++) CHECK(panels[i].matches(*d[i]));
+
+      // Small changes, sent a frame at a time
+      for(int f = 0; f < 10; f++) {
+        memset(r->touched, 0, sizeof(r->touched));
+        for(uint8_t i = 0; i < 4; i++) {
+          panels[i].commands = panels[i].data = panels[i].txns = 0;
+          memset(panels[i].written, 0, sizeof(panels[i].written));
+        }
+        for(int k = rand() % 3; k >= 0; k--) draw(t, r, 60, false);
+        t.display();
+        route();
+        for(uint8_t i = 0; i < 4; i++) {
+          const SSD1306_Emu &p = panels[i];
+          bool any = false, window = true;
+          for(uint8_t page = 0; page < 8; page++) {
+            int16_t lo = 128, hi = -1; // Columns drawn to in this page
+            for(int16_t y = page * 8; y < page * 8 + 8; y++) {
+              for(int16_t x = 0; x < 128; x++) {
+                if(!r->touched[oy[i] + y][ox[i] + x]) continue;
+                // Tile 3 is upside down: canvas to panel RAM coordinates
+                int16_t col = (i == 3) ? 127 - x : x;
+                lo = min(lo, col);
+                hi = max(hi, col);
+              }
+            }
+            uint8_t ramPage = (i == 3) ? 7 - page : page;
+            for(int16_t col = 0; col < 128; col++) {
+              window &= p.written[ramPage * 128 + col] ==
+                        ((col >= lo) && (col <= hi));
+            }
+            any |= hi >= 0;
+          }
+          if(any) {
+            partial++;
+            CHECK(window);
+          } else { // Not a byte, not even a window command
+            quiet++;
+            CHECK(!p.txns && !p.commands && !p.data);
+          }
+          CHECK(p.matches(*d[i]));
+        }
+      }
+      for(uint8_t i = 0; i < 4; i++) delete d[i];
+      delete r;
+    }
+  }
+  CHECK(quiet > 100);
+  CHECK(partial > 100);
+  return report();
+}
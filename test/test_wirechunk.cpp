@@ -0,0 +1,30 @@
+// setWireChunkSize(): requests are clamped to 2 .. the Wire buffer size,
+// no I2C transmission is longer than that, and frames arrive intact.
+
+#include "harness.h"
+
+int main(void) {
+  const uint16_t ask[]  = { 0, 2, 17, BUFFER_LENGTH, 129, 1000 };
+  const uint16_t want[] = { 2, 2, 17, BUFFER_LENGTH, BUFFER_LENGTH,
+                            BUFFER_LENGTH };
+  for(uint8_t i = 0; i < sizeof(ask) / sizeof(ask[0]); i++) {
+    Adafruit_SSD1306 d(128, 64, &Wire);
+    SSD1306_Emu      emu;
+    CHECK(d.begin(SSD1306_SWITCHCAPVCC, 0x3C));
+    emu.feed(Wire);
+    CHECK(d.setWireChunkSize(ask[i]) == want[i]);
+
+    for(int p = 0; p < 200; p++) d.drawPixel((p * 37) % 128, (p * 11) % 64, 1);
+    d.fillRect(10, 10, 100, 20, SSD1306_INVERSE);
+    d.display();
+    size_t longest = 0;
+    for(size_t t = 0; t < Wire.txns.size(); t++) {
+      longest = max(longest, Wire.txns[t].bytes.size());
+    }
+    CHECK(longest <= want[i]);
+    emu.feed(Wire);
+    CHECK(emu.matches(d));
+  }
+  CHECK(Wire.overruns == 0);
+  return report();
+}